@@ -29,10 +29,21 @@ public:
      * @return Allocated memory address or a null pointer.
      */
     static void* allocate(size_t size);
+
+    /**
+     * @brief Allocates aligned memory.
+     *
+     * @param size      Number of bytes to allocate.
+     * @param alignment Alignment in bytes being a power of two, like a cache line, SIMD register or page size.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size, size_t alignment);
     
     /**
      * @brief Frees allocated memory.
      *
+     * Memory allocated with and without an alignment is freed alike.
+     *
      * @param ptr Address of allocated memory block or a null pointer.
      */
     static void free(void* ptr);
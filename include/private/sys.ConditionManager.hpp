@@ -0,0 +1,120 @@
+/**
+ * @file      sys.ConditionManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONDITIONMANAGER_HPP_
+#define SYS_CONDITIONMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.ConditionFactory.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_CONDITION_VARIABLES
+/**
+ * @brief Number of condition variables which memory is statically allocated.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_CONDITION_VARIABLES (256)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_CONDITION_VARIABLES
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_EVENTS
+/**
+ * @brief Number of events which memory is statically allocated.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_EVENTS (256)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_EVENTS
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ConditionManager.
+ * @brief Condition variable and event sub-system manager.
+ */
+class ConditionManager : public NonCopyable<NoAllocator>, public ConditionFactory
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ConditionManager() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ConditionManager() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::ConditionFactory::createConditionVariable()
+     */
+    ConditionVariable* createConditionVariable() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::ConditionFactory::createEvent(bool_t,bool_t)
+     */
+    Event* createEvent(bool_t isManualReset, bool_t isSet) noexcept override;
+
+    /**
+     * @brief Allocates memory for a condition variable or an event.
+     *
+     * The memory is taken from the static pools first, and from the heap if the pools are exhausted.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees memory of a condition variable or an event.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);
+
+private:
+    
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    ConditionManager(ConditionManager const&) noexcept = delete;
+    
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */       
+    ConditionManager& operator=(ConditionManager const&) noexcept = delete;   
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */       
+    ConditionManager(ConditionManager&&) noexcept = delete;
+    
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    ConditionManager& operator=(ConditionManager&&) & noexcept = delete;
+
+    /**
+     * @struct Pool
+     * @brief Static memory pools of the sub-system resources.
+     */
+    struct Pool;
+
+    /**
+     * @brief The static memory pools.
+     */
+    static Pool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONDITIONMANAGER_HPP_
@@ -0,0 +1,273 @@
+/**
+ * @file      sys.ConditionVariableSlim.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONDITIONVARIABLESLIM_HPP_
+#define SYS_CONDITIONVARIABLESLIM_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.ConditionVariable.hpp"
+#include "sys.Timeout.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ConditionVariableSlim.
+ * @brief Condition variable class.
+ *
+ * The variable is a Windows condition variable which sleeps on an own slim reader/writer lock,
+ * thus it works with mutexes of any type. A waiting thread takes the own lock before it unlocks
+ * the mutex, and a notifying thread takes the own lock before it wakes waiting threads up,
+ * so a notification between unlocking the mutex and sleeping is not lost. Notifications wake up
+ * only the threads notified. A timed wait sleeps until the deadline of its timeout,
+ * and a wait of the kernel timer which returns before the deadline is continued.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class ConditionVariableSlim : public NonCopyable<A>, public ConditionVariable
+{
+    using Parent = NonCopyable<A>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ConditionVariableSlim() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ConditionVariableSlim() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::ConditionVariable::wait(api::Mutex&)
+     */
+    bool_t wait(api::Mutex& mutex) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::ConditionVariable::waitFor(api::Mutex&,uint64_t)
+     */
+    bool_t waitFor(api::Mutex& mutex, uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::ConditionVariable::wait(TimedMutex&)
+     */
+    bool_t wait(TimedMutex& mutex) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::ConditionVariable::waitFor(TimedMutex&,uint64_t)
+     */
+    bool_t waitFor(TimedMutex& mutex, uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::ConditionVariable::notifyOne()
+     */
+    bool_t notifyOne() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::ConditionVariable::notifyAll()
+     */
+    bool_t notifyAll() noexcept override;
+
+private:
+
+    /**
+     * @brief Waits until the variable is notified or the timeout expires.
+     *
+     * @param mutex     The mutex.
+     * @param timeoutUs Timeout in microseconds.
+     * @return True if the variable has been notified.
+     */
+    bool_t waitUntil(api::Mutex& mutex, uint64_t timeoutUs) noexcept;
+
+    /**
+     * @brief Sleeps on the variable unlocking the mutex.
+     *
+     * @param mutex   The mutex.
+     * @param timeout The timeout, or NULLPTR to sleep infinitely.
+     * @return True if the variable has been notified.
+     */
+    bool_t sleep(api::Mutex& mutex, Timeout* timeout) noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    ConditionVariableSlim(ConditionVariableSlim const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    ConditionVariableSlim& operator=(ConditionVariableSlim const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    ConditionVariableSlim(ConditionVariableSlim&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    ConditionVariableSlim& operator=(ConditionVariableSlim&&) & noexcept = delete;
+
+    /**
+     * @brief Windows condition variable object.
+     */
+    ::CONDITION_VARIABLE cv_ = CONDITION_VARIABLE_INIT;
+
+    /**
+     * @brief Windows slim reader/writer lock the waiting threads sleep on.
+     */
+    ::SRWLOCK lock_ = SRWLOCK_INIT;
+
+};
+
+template <class A>
+ConditionVariableSlim<A>::ConditionVariableSlim() noexcept
+    : NonCopyable<A>()
+    , ConditionVariable() {
+    setConstructed( true );
+}
+
+template <class A>
+bool_t ConditionVariableSlim<A>::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t ConditionVariableSlim<A>::wait(api::Mutex& mutex) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        res = sleep(mutex, NULLPTR);
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t ConditionVariableSlim<A>::waitFor(api::Mutex& mutex, uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        res = waitUntil(mutex, timeoutUs);
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t ConditionVariableSlim<A>::wait(TimedMutex& mutex) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (!mutex.isLockedRecursively()) )
+    {
+        res = sleep(mutex, NULLPTR);
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t ConditionVariableSlim<A>::waitFor(TimedMutex& mutex, uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (!mutex.isLockedRecursively()) )
+    {
+        res = waitUntil(mutex, timeoutUs);
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t ConditionVariableSlim<A>::notifyOne() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::AcquireSRWLockExclusive(&lock_);
+        ::WakeConditionVariable(&cv_);
+        ::ReleaseSRWLockExclusive(&lock_);
+        res = true;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t ConditionVariableSlim<A>::notifyAll() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::AcquireSRWLockExclusive(&lock_);
+        ::WakeAllConditionVariable(&cv_);
+        ::ReleaseSRWLockExclusive(&lock_);
+        res = true;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t ConditionVariableSlim<A>::waitUntil(api::Mutex& mutex, uint64_t const timeoutUs) noexcept
+{
+    bool_t res{ false };
+    Timeout timeout( timeoutUs );
+    if( timeout.isConstructed() )
+    {
+        res = sleep(mutex, &timeout);
+    }
+    return res;
+}
+
+template <class A>
+bool_t ConditionVariableSlim<A>::sleep(api::Mutex& mutex, Timeout* const timeout) noexcept
+{
+    bool_t res{ false };
+    ::AcquireSRWLockExclusive(&lock_);
+    if( mutex.unlock() )
+    {
+        bool_t isRetry{ true };
+        while(isRetry)
+        {
+            ::DWORD const ms{ (timeout != NULLPTR) ? timeout->getMilliseconds() : INFINITE };
+            res = ::SleepConditionVariableSRW(&cv_, &lock_, ms, 0U) != 0;
+            // Notifications are not lost while the own lock is held, so sleep the rest of the timeout
+            isRetry = (!res) && (timeout != NULLPTR) && (::GetLastError() == ERROR_TIMEOUT) && (!timeout->isExpired());
+        }
+        ::ReleaseSRWLockExclusive(&lock_);
+        // The mutex is locked again even if the thread has not been notified
+        bool_t const isLocked{ mutex.lock() };
+        res = res && isLocked;
+    }
+    else
+    {
+        ::ReleaseSRWLockExclusive(&lock_);
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONDITIONVARIABLESLIM_HPP_
@@ -0,0 +1,231 @@
+/**
+ * @file      sys.EventKernel.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENTKERNEL_HPP_
+#define SYS_EVENTKERNEL_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Event.hpp"
+#include "sys.Timeout.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class EventKernel.
+ * @brief Event class.
+ *
+ * The event is a Windows event object.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class EventKernel : public NonCopyable<A>, public Event
+{
+    using Parent = NonCopyable<A>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param isManualReset The event is reset manually, otherwise it is reset when a waiting thread is released.
+     * @param isSet         The initial state of the event.
+     */
+    EventKernel(bool_t isManualReset, bool_t isSet) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~EventKernel() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Event::set()
+     */
+    bool_t set() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Event::reset()
+     */
+    bool_t reset() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Event::wait()
+     */
+    bool_t wait() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Event::waitFor(uint64_t)
+     */
+    bool_t waitFor(uint64_t timeoutUs) noexcept override;
+
+private:
+
+    /**
+     * @copydoc eoos::sys::Waitable::getWaitHandle()
+     */
+    void* getWaitHandle() noexcept override;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param isManualReset The event is reset manually.
+     * @param isSet         The initial state of the event.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(bool_t isManualReset, bool_t isSet) noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    EventKernel(EventKernel const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    EventKernel& operator=(EventKernel const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    EventKernel(EventKernel&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    EventKernel& operator=(EventKernel&&) & noexcept = delete;
+
+    /**
+     * @brief A Windows handle of this event.
+     */
+    ::HANDLE handle_{ NULLPTR };
+
+};
+
+template <class A>
+EventKernel<A>::EventKernel(bool_t isManualReset, bool_t isSet) noexcept
+    : NonCopyable<A>()
+    , Event() {
+    bool_t const isConstructed{ construct(isManualReset, isSet) };
+    setConstructed( isConstructed );
+}
+
+template <class A>
+EventKernel<A>::~EventKernel() noexcept
+{
+    if(handle_ != NULLPTR)
+    {
+        static_cast<void>( ::CloseHandle(handle_) );
+        handle_ = NULLPTR;
+    }
+}
+
+template <class A>
+bool_t EventKernel<A>::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t EventKernel<A>::set() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        res = ::SetEvent(handle_) != 0;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t EventKernel<A>::reset() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        res = ::ResetEvent(handle_) != 0;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t EventKernel<A>::wait() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::DWORD const error{ ::WaitForSingleObject(handle_, INFINITE) };
+        res = ( error == static_cast< ::DWORD >(WAIT_OBJECT_0) );
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t EventKernel<A>::waitFor(uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        Timeout timeout( timeoutUs );
+        if( timeout.isConstructed() )
+        {
+            ::DWORD const error{ timeout.wait(handle_) };
+            res = ( error == static_cast< ::DWORD >(WAIT_OBJECT_0) );
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+void* EventKernel<A>::getWaitHandle() noexcept
+{
+    return isConstructed() ? handle_ : NULLPTR;
+}
+
+template <class A>
+bool_t EventKernel<A>::construct(bool_t isManualReset, bool_t isSet) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::LPSECURITY_ATTRIBUTES const lpEventAttributes{ NULL };
+        ::BOOL const bManualReset{ isManualReset ? TRUE : FALSE };
+        ::BOOL const bInitialState{ isSet ? TRUE : FALSE };
+        ::LPCSTR lpName{ NULL };
+        ::HANDLE const handle{ ::CreateEvent(
+            lpEventAttributes,
+            bManualReset,
+            bInitialState,
+            lpName
+        ) };
+        if(handle != NULLPTR)
+        {
+            handle_ = handle;
+            res = true;
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENTKERNEL_HPP_
@@ -7,6 +7,25 @@
 #define SYS_HEAP_HPP_
 
 #include "api.Heap.hpp"
+#include "sys.HeapSlab.hpp"
+#include "sys.HeapLarge.hpp"
+#include "sys.HeapArena.hpp"
+#include "sys.HeapMonitor.hpp"
+#include "sys.HeapTracer.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_HEAP_LARGE_BLOCK_SIZE
+/**
+ * @brief Size in bytes from which blocks are allocated by the large block allocator.
+ */
+#define EOOS_GLOBAL_SYS_HEAP_LARGE_BLOCK_SIZE (0x00100000U)
+#endif // EOOS_GLOBAL_SYS_HEAP_LARGE_BLOCK_SIZE
+
+#ifndef EOOS_GLOBAL_SYS_HEAP_ARENA_SIZE
+/**
+ * @brief Size in bytes of the static memory region of the heap in no heap mode.
+ */
+#define EOOS_GLOBAL_SYS_HEAP_ARENA_SIZE (0x00100000U)
+#endif // EOOS_GLOBAL_SYS_HEAP_ARENA_SIZE
 
 namespace eoos
 {
@@ -16,6 +35,14 @@ namespace sys
 /**
  * @class Heap.
  * @brief Heap class.
+ *
+ * Small blocks are served by the slab allocator, blocks of EOOS_GLOBAL_SYS_HEAP_LARGE_BLOCK_SIZE
+ * bytes and greater are served by the large block allocator, and other blocks
+ * or blocks the allocators run out of are allocated from the process heap.
+ * If EOOS_GLOBAL_ENABLE_NO_HEAP is defined, blocks are allocated by the region arena
+ * from a static memory region of EOOS_GLOBAL_SYS_HEAP_ARENA_SIZE bytes.
+ * If EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS is defined, allocations and frees are accounted by the monitor.
+ * If EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE is defined, allocations and frees are recorded by the tracer.
  */
 class Heap : public api::Heap
 {
@@ -38,16 +65,97 @@ public:
     bool_t isConstructed() const noexcept override;
     
     /**
-     * @copydoc eoos::api::Heap::allocate(size_t,void*)
+     * @brief Allocates or reallocates memory.
+     *
+     * If the given address is a null pointer, a new block is allocated. Otherwise, the block
+     * is resized in place if possible, or it is moved to a new block with its content
+     * copied and the old block freed. If the size is zero, the block is freed.
+     *
+     * @param size Number of bytes to allocate.
+     * @param ptr  Address of allocated memory block to reallocate or a null pointer.
+     * @return Allocated memory address or a null pointer. If reallocation fails, the old block is kept.
      */
     void* allocate(size_t const size, void* ptr) noexcept override;
 
+    /**
+     * @brief Allocates aligned memory.
+     *
+     * Blocks aligned to 64 bytes and less are served by slabs of the size class of the alignment
+     * and greater, which makes cache line and SIMD aligned blocks cost no padding. Blocks which are
+     * greater or aligned to more bytes up to the allocation granularity, like pages, are served
+     * by the large block allocator. The block is freed by the free function and can be reallocated,
+     * but the reallocated block is not guaranteed to keep the alignment.
+     *
+     * @param size      Number of bytes to allocate.
+     * @param alignment Alignment in bytes being a power of two.
+     * @return Allocated memory address or a null pointer.
+     */
+    void* allocateAligned(size_t size, size_t alignment) noexcept;
+
     /**
      * @copydoc eoos::api::Heap::free(void*)
      */
     void free(void* ptr) noexcept override;
+
+    /**
+     * @brief Returns usable size of allocated memory.
+     *
+     * @param ptr Address of allocated memory block.
+     * @return Number of bytes which can be used in the block, or zero if the address is a null pointer.
+     */
+    size_t getUsableSize(void const* ptr) const noexcept;
+
+    /**
+     * @brief Returns the heap statistics.
+     *
+     * @return The statistics.
+     */
+    HeapStatistics& getStatistics() noexcept;
+
+    /**
+     * @brief Returns the heap allocation trace.
+     *
+     * @return The trace.
+     */
+    HeapTrace& getTrace() noexcept;
+
+    #ifdef EOOS_GLOBAL_ENABLE_NO_HEAP
+
+    /**
+     * @brief Returns the region arena blocks are allocated from.
+     *
+     * @return The arena.
+     */
+    HeapArena& getArena() noexcept;
+
+    #endif // EOOS_GLOBAL_ENABLE_NO_HEAP
     
 private:
+
+    /**
+     * @brief Allocates new memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    void* allocateBlock(size_t size) noexcept;
+
+    /**
+     * @brief Records an allocation to the statistics and the trace.
+     *
+     * @param addr Allocated memory address or a null pointer if the allocation has failed.
+     * @param size Number of bytes requested.
+     */
+    void recordAllocation(void* addr, size_t size) noexcept;
+
+    /**
+     * @brief Resizes allocated memory in place.
+     *
+     * @param ptr  Address of allocated memory block.
+     * @param size New number of bytes of the block.
+     * @return True if the block has been resized.
+     */
+    bool_t resizeBlock(void* ptr, size_t size) noexcept;
     
     /**
      * @copydoc eoos::Object::Object(Object const&)
@@ -69,6 +177,52 @@ private:
      */
     Heap& operator=(Heap&&) & noexcept = delete;        
 
+    /**
+     * @brief Alignment in bytes which all allocated blocks have.
+     */
+    static const size_t DEFAULT_ALIGNMENT{ MEMORY_ALLOCATION_ALIGNMENT };
+
+    /**
+     * @brief The heap statistics monitor.
+     */
+    HeapMonitor monitor_{};
+
+    /**
+     * @brief The heap allocation tracer.
+     */
+    HeapTracer tracer_{};
+
+    #ifndef EOOS_GLOBAL_ENABLE_NO_HEAP
+
+    /**
+     * @brief The slab allocator of small blocks.
+     */
+    HeapSlab slab_{};
+
+    /**
+     * @brief The allocator of large blocks.
+     */
+    HeapLarge large_{};
+
+    /**
+     * @brief The process heap of large blocks.
+     */
+    ::HANDLE heap_{ ::GetProcessHeap() };
+
+    #else
+
+    /**
+     * @brief The static memory region of the arena.
+     */
+    alignas(16) static ucell_t memory_[EOOS_GLOBAL_SYS_HEAP_ARENA_SIZE];
+
+    /**
+     * @brief The region arena.
+     */
+    HeapArena arena_{ memory_, sizeof(memory_) };
+
+    #endif // EOOS_GLOBAL_ENABLE_NO_HEAP
+
 };
 
 } // namespace sys
@@ -0,0 +1,255 @@
+/**
+ * @file      sys.HeapArena.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_HEAPARENA_HPP_
+#define SYS_HEAPARENA_HPP_
+
+#include "sys.NonCopyable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class HeapArena.
+ * @brief Region arena memory allocator.
+ *
+ * The arena allocates blocks from a given memory region by bumping an offset,
+ * thus allocation takes constant time and the region is never fragmented.
+ * Memory is given back by rewinding the arena to a mark taken before,
+ * by resetting the whole arena, or by freeing the last allocated block.
+ */
+class HeapArena : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @class Scope.
+     * @brief Guard rewinding an arena to the state it had at the guard construction.
+     */
+    class Scope : public NonCopyable<NoAllocator>
+    {
+        using Parent = NonCopyable<NoAllocator>;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param arena The arena to guard.
+         */
+        explicit Scope(HeapArena& arena) noexcept;
+
+        /**
+         * @brief Destructor.
+         */
+        ~Scope() noexcept override;
+
+    private:
+
+        /**
+         * @copydoc eoos::Object::Object(Object const&)
+         */
+        Scope(Scope const&) noexcept = delete;
+
+        /**
+         * @copydoc eoos::Object::operator=(Object const&)
+         */
+        Scope& operator=(Scope const&) noexcept = delete;
+
+        /**
+         * @copydoc eoos::Object::Object(Object&&)
+         */
+        Scope(Scope&&) noexcept = delete;
+
+        /**
+         * @copydoc eoos::Object::operator=(Object&&)
+         */
+        Scope& operator=(Scope&&) & noexcept = delete;
+
+        /**
+         * @brief The guarded arena.
+         */
+        HeapArena& arena_;
+
+        /**
+         * @brief The arena mark to rewind to.
+         */
+        size_t const mark_;
+
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param memory Memory region aligned to 16 bytes.
+     * @param size   Size of the region in bytes.
+     */
+    HeapArena(void* memory, size_t size) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~HeapArena() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address aligned to 16 bytes or a null pointer.
+     */
+    void* allocate(size_t size) noexcept;
+
+    /**
+     * @brief Allocates aligned memory.
+     *
+     * @param size      Number of bytes to allocate.
+     * @param alignment Alignment in bytes being a power of two.
+     * @return Allocated memory address or a null pointer.
+     */
+    void* allocate(size_t size, size_t alignment) noexcept;
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * The memory is given back to the arena only if the block is the last allocated one,
+     * otherwise it is given back when the arena is rewound or reset.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    void free(void* ptr) noexcept;
+
+    /**
+     * @brief Tests if memory belongs to this arena.
+     *
+     * @param ptr Address of memory block.
+     * @return True if the memory has been allocated by this arena.
+     */
+    bool_t isOwned(void const* ptr) const noexcept;
+
+    /**
+     * @brief Returns usable size of a block.
+     *
+     * @param ptr Address of memory block allocated by this arena.
+     * @return Number of bytes which can be used in the block.
+     */
+    size_t getSize(void const* ptr) const noexcept;
+
+    /**
+     * @brief Resizes a block in place.
+     *
+     * A block is always shrunk, and it is grown only if it is the last allocated one
+     * and the arena has enough free memory.
+     *
+     * @param ptr  Address of memory block allocated by this arena.
+     * @param size New number of bytes of the block.
+     * @return True if the block has been resized.
+     */
+    bool_t resize(void* ptr, size_t size) noexcept;
+
+    /**
+     * @brief Returns a mark of the current arena state.
+     *
+     * @return The mark.
+     */
+    size_t getMark() const noexcept;
+
+    /**
+     * @brief Rewinds the arena to a mark.
+     *
+     * All blocks allocated after the mark has been taken are freed.
+     *
+     * @param mark The mark.
+     * @return True if the arena has been rewound.
+     */
+    bool_t rewind(size_t mark) noexcept;
+
+    /**
+     * @brief Frees all blocks of the arena.
+     */
+    void reset() noexcept;
+
+private:
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    HeapArena(HeapArena const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    HeapArena& operator=(HeapArena const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    HeapArena(HeapArena&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    HeapArena& operator=(HeapArena&&) & noexcept = delete;
+
+    /**
+     * @struct Header
+     * @brief Block header.
+     */
+    struct Header
+    {
+        /**
+         * @brief Size of the block in bytes.
+         */
+        size_t size;
+
+        /**
+         * @brief Offset of free memory in the region before the block has been allocated.
+         */
+        size_t begin;
+    };
+
+    /**
+     * @brief Size of block header in bytes.
+     */
+    static const size_t HEADER_SIZE{ 16U };
+
+    /**
+     * @brief Alignment of blocks in bytes.
+     */
+    static const size_t ALIGNMENT{ 16U };
+
+    /**
+     * @brief Memory region.
+     */
+    ucell_t* const memory_;
+
+    /**
+     * @brief Size of the memory region in bytes.
+     */
+    size_t const size_;
+
+    /**
+     * @brief Offset of free memory in the region.
+     */
+    size_t offset_{ 0U };
+
+    /**
+     * @brief Lock of the arena state.
+     */
+    ::SRWLOCK lock_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_HEAPARENA_HPP_
@@ -0,0 +1,245 @@
+/**
+ * @file      sys.HeapLarge.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_HEAPLARGE_HPP_
+#define SYS_HEAPLARGE_HPP_
+
+#include "sys.NonCopyable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class HeapLarge.
+ * @brief Large block memory allocator.
+ *
+ * Each block is a separate reservation of virtual address space which pages are
+ * committed only for the requested size, thus the block can be grown in place
+ * up to its reservation, and all its memory is returned to the system on free.
+ * If the system is built with EOOS_GLOBAL_SYS_HEAP_ENABLE_LARGE_PAGES and the process
+ * has the lock pages in memory privilege, blocks of large page size and greater
+ * are allocated in large pages. Blocks are kept in a table hashed by their reservation
+ * addresses, so a block is found by its memory in constant time.
+ */
+class HeapLarge : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    HeapLarge() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~HeapLarge() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address aligned to HEADER_SIZE bytes or a null pointer.
+     */
+    void* allocate(size_t size) noexcept;
+
+    /**
+     * @brief Allocates aligned memory.
+     *
+     * @param size      Number of bytes to allocate.
+     * @param alignment Alignment in bytes being a power of two less than the allocation granularity.
+     * @return Allocated memory address or a null pointer.
+     */
+    void* allocate(size_t size, size_t alignment) noexcept;
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of memory block allocated by this allocator.
+     */
+    void free(void* ptr) noexcept;
+
+    /**
+     * @brief Tests if memory belongs to this allocator.
+     *
+     * @param ptr Address of memory block.
+     * @return True if the memory has been allocated by this allocator.
+     */
+    bool_t isOwned(void const* ptr) const noexcept;
+
+    /**
+     * @brief Returns usable size of a block.
+     *
+     * @param ptr Address of memory block allocated by this allocator.
+     * @return Number of bytes which can be used in the block.
+     */
+    size_t getSize(void const* ptr) const noexcept;
+
+    /**
+     * @brief Resizes a block in place.
+     *
+     * Pages are committed or decommitted within the block reservation.
+     *
+     * @param ptr  Address of memory block allocated by this allocator.
+     * @param size New number of bytes of the block.
+     * @return True if the block has been resized.
+     */
+    bool_t resize(void* ptr, size_t size) noexcept;
+
+private:
+
+    /**
+     * @struct Block
+     * @brief Header of block placed at the beginning of its reservation.
+     */
+    struct Block
+    {
+        /**
+         * @brief Next block in the bucket of the table of blocks.
+         */
+        Block* next;
+
+        /**
+         * @brief Number of reserved bytes.
+         */
+        size_t reserved;
+
+        /**
+         * @brief Number of committed bytes.
+         */
+        size_t committed;
+
+        /**
+         * @brief Offset of memory given to user from the block beginning.
+         */
+        size_t offset;
+
+        /**
+         * @brief The block is allocated in large pages.
+         */
+        bool_t isLargePage;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Enables the lock pages in memory privilege for the process.
+     *
+     * @return True if the privilege has been enabled.
+     */
+    static bool_t enableLargePages() noexcept;
+
+    /**
+     * @brief Rounds a size up to a power of two boundary.
+     *
+     * @param size     The size.
+     * @param boundary The boundary.
+     * @return The rounded size, or zero if the size overflows.
+     */
+    static size_t roundUp(size_t size, size_t boundary) noexcept;
+
+    /**
+     * @brief Returns the block header of memory.
+     *
+     * @param ptr Address of memory block.
+     * @return The block.
+     */
+    Block* getBlock(void const* ptr) const noexcept;
+
+    /**
+     * @brief Finds a block in the table of blocks.
+     *
+     * @param ptr Address of memory block.
+     * @return The block or a null pointer.
+     */
+    Block* findBlock(void const* ptr) const noexcept;
+
+    /**
+     * @brief Returns the bucket of the table of blocks a block belongs to.
+     *
+     * @param block The block.
+     * @return Index of the bucket.
+     */
+    size_t getBucket(Block const* block) const noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    HeapLarge(HeapLarge const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    HeapLarge& operator=(HeapLarge const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    HeapLarge(HeapLarge&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    HeapLarge& operator=(HeapLarge&&) & noexcept = delete;
+
+    /**
+     * @brief Size of block header in bytes keeping blocks aligned to cache line.
+     */
+    static const size_t HEADER_SIZE{ 64U };
+
+    /**
+     * @brief Multiplier of reservation to a requested size to grow blocks in place.
+     */
+    static const size_t RESERVE_FACTOR{ (sizeof(void*) == 8U) ? 2U : 1U };
+
+    /**
+     * @brief Number of buckets of the table of blocks being a power of two.
+     */
+    static const size_t NUMBER_OF_BUCKETS{ 1024U };
+
+    /**
+     * @brief Size of page in bytes.
+     */
+    size_t pageSize_{ 0U };
+
+    /**
+     * @brief Granularity of address space reservation in bytes.
+     */
+    size_t granularity_{ 0U };
+
+    /**
+     * @brief Size of large page in bytes, or zero if large pages are not used.
+     */
+    size_t largePageSize_{ 0U };
+
+    /**
+     * @brief Table of allocated blocks hashed by their addresses.
+     */
+    Block* buckets_[NUMBER_OF_BUCKETS];
+
+    /**
+     * @brief Lock of the table of blocks.
+     */
+    mutable ::SRWLOCK lock_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_HEAPLARGE_HPP_
@@ -0,0 +1,218 @@
+/**
+ * @file      sys.HeapMonitor.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_HEAPMONITOR_HPP_
+#define SYS_HEAPMONITOR_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.HeapStatistics.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class HeapMonitor.
+ * @brief Heap statistics gathering.
+ *
+ * The heap reports allocations and frees to the monitor only if the system is built 
+ * with EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS, otherwise the heap does no extra work.
+ */
+class HeapMonitor : public NonCopyable<NoAllocator>, public HeapStatistics
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    HeapMonitor() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~HeapMonitor() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapStatistics::isEnabled()
+     */
+    bool_t isEnabled() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapStatistics::getCounters(Counters&)
+     */
+    bool_t getCounters(Counters& counters) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapStatistics::getHistogram(int32_t)
+     */
+    uint64_t getHistogram(int32_t bin) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapStatistics::getTagAllocations(int32_t)
+     */
+    uint64_t getTagAllocations(int32_t tag) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapStatistics::getTagBytes(int32_t)
+     */
+    uint64_t getTagBytes(int32_t tag) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapStatistics::setTag(int32_t)
+     */
+    int32_t setTag(int32_t tag) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapStatistics::reset()
+     */
+    void reset() noexcept override;
+
+    /**
+     * @brief Accounts an allocation.
+     *
+     * @param size   Requested number of bytes.
+     * @param usable Usable number of bytes of the allocated block.
+     */
+    void recordAllocation(size_t size, size_t usable) noexcept;
+
+    /**
+     * @brief Accounts a failed allocation.
+     */
+    void recordFailure() noexcept;
+
+    /**
+     * @brief Accounts a free.
+     *
+     * @param usable Usable number of bytes of the freed block.
+     */
+    void recordFree(size_t usable) noexcept;
+
+    /**
+     * @brief Accounts a block resized in place.
+     *
+     * @param oldUsable Usable number of bytes of the block before resizing.
+     * @param newUsable Usable number of bytes of the block after resizing.
+     */
+    void recordResize(size_t oldUsable, size_t newUsable) noexcept;
+
+private:
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Adds a number of bytes to the live bytes counter and updates the peak.
+     *
+     * @param bytes Number of bytes.
+     */
+    void addLiveBytes(::LONG64 bytes) noexcept;
+
+    /**
+     * @brief Returns the calling thread tag.
+     *
+     * @return The tag.
+     */
+    int32_t getTag() const noexcept;
+
+    /**
+     * @brief Returns a counter value.
+     *
+     * @param counter The counter.
+     * @return The value.
+     */
+    static uint64_t getValue(::LONG64 const volatile& counter) noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    HeapMonitor(HeapMonitor const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    HeapMonitor& operator=(HeapMonitor const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    HeapMonitor(HeapMonitor&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    HeapMonitor& operator=(HeapMonitor&&) & noexcept = delete;
+
+    /**
+     * @brief Number of bytes currently allocated.
+     */
+    volatile ::LONG64 liveBytes_{ 0 };
+
+    /**
+     * @brief Maximum number of bytes allocated at once.
+     */
+    volatile ::LONG64 peakBytes_{ 0 };
+
+    /**
+     * @brief Number of successful allocations.
+     */
+    volatile ::LONG64 allocations_{ 0 };
+
+    /**
+     * @brief Number of frees.
+     */
+    volatile ::LONG64 frees_{ 0 };
+
+    /**
+     * @brief Number of failed allocations.
+     */
+    volatile ::LONG64 failures_{ 0 };
+
+    /**
+     * @brief Size histogram.
+     */
+    volatile ::LONG64 histogram_[NUMBER_OF_BINS];
+
+    /**
+     * @brief Number of allocations of tags.
+     */
+    volatile ::LONG64 tagAllocations_[NUMBER_OF_TAGS];
+
+    /**
+     * @brief Number of bytes allocated by tags.
+     */
+    volatile ::LONG64 tagBytes_[NUMBER_OF_TAGS];
+
+    /**
+     * @brief Performance counter value of the last reset.
+     */
+    ::LONGLONG start_{ 0 };
+
+    /**
+     * @brief Performance counter frequency.
+     */
+    ::LONGLONG frequency_{ 0 };
+
+    /**
+     * @brief Thread local storage index of thread tags.
+     */
+    ::DWORD tagIndex_{ TLS_OUT_OF_INDEXES };
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_HEAPMONITOR_HPP_
@@ -0,0 +1,179 @@
+/**
+ * @file      sys.HeapReplayer.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_HEAPREPLAYER_HPP_
+#define SYS_HEAPREPLAYER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.HeapBenchmark.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class HeapReplayer.
+ * @brief Heap allocation trace replay.
+ *
+ * Addresses of the trace are mapped to blocks of the replayed heap by an open addressing
+ * hash table, and latency of each operation is kept to sort them for percentiles.
+ * The working memory is committed directly from the system for the replay only,
+ * so it is neither taken from the heap being measured nor kept after the replay.
+ */
+class HeapReplayer : public NonCopyable<NoAllocator>, public HeapBenchmark
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    HeapReplayer() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~HeapReplayer() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapBenchmark::replay(api::Heap&, HeapTrace::Record const*, size_t, Report&)
+     */
+    bool_t replay(api::Heap& heap, HeapTrace::Record const* records, size_t count, Report& report) noexcept override;
+
+private:
+
+    /**
+     * @struct Entry
+     * @brief Entry of the address map.
+     */
+    struct Entry
+    {
+        /**
+         * @brief Address of the block in the trace, or EMPTY, or REMOVED.
+         */
+        uint64_t address;
+
+        /**
+         * @brief The block allocated by the replayed heap.
+         */
+        void* block;
+
+        /**
+         * @brief Number of bytes requested for the block.
+         */
+        size_t size;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Adds a block to the address map.
+     *
+     * @param map      The map.
+     * @param capacity Number of entries of the map being a power of two.
+     * @param address  Address of the block in the trace.
+     * @param block    The block allocated by the replayed heap.
+     * @param size     Number of bytes requested for the block.
+     */
+    static void insert(Entry* map, size_t capacity, uint64_t address, void* block, size_t size) noexcept;
+
+    /**
+     * @brief Finds a block in the address map.
+     *
+     * @param map      The map.
+     * @param capacity Number of entries of the map being a power of two.
+     * @param address  Address of the block in the trace.
+     * @return The entry of the block, or a null pointer if the address is not mapped.
+     */
+    static Entry* find(Entry* map, size_t capacity, uint64_t address) noexcept;
+
+    /**
+     * @brief Returns the first entry to probe for an address.
+     *
+     * @param address  Address of the block in the trace.
+     * @param capacity Number of entries of the map being a power of two.
+     * @return Index of the entry.
+     */
+    static size_t getIndex(uint64_t address, size_t capacity) noexcept;
+
+    /**
+     * @brief Sorts values in ascending order by heapsort.
+     *
+     * @param values The values.
+     * @param count  Number of the values.
+     */
+    static void sort(uint64_t* values, size_t count) noexcept;
+
+    /**
+     * @brief Sifts a value down the heap of heapsort.
+     *
+     * @param values The values.
+     * @param root   Index of the value to sift.
+     * @param count  Number of the values in the heap.
+     */
+    static void sift(uint64_t* values, size_t root, size_t count) noexcept;
+
+    /**
+     * @brief Returns a percentile of sorted latencies in nanoseconds.
+     *
+     * @param latencies Sorted latencies in ticks.
+     * @param count     Number of the latencies.
+     * @param permille  The percentile in tenths of percent.
+     * @return The latency in nanoseconds.
+     */
+    uint64_t getPercentile(uint64_t const* latencies, size_t count, uint64_t permille) const noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    HeapReplayer(HeapReplayer const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    HeapReplayer& operator=(HeapReplayer const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    HeapReplayer(HeapReplayer&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    HeapReplayer& operator=(HeapReplayer&&) & noexcept = delete;
+
+    /**
+     * @brief Address of free entries of the map.
+     */
+    static const uint64_t EMPTY{ 0U };
+
+    /**
+     * @brief Address of entries of removed blocks, which do not stop probing.
+     */
+    static const uint64_t REMOVED{ 0xFFFFFFFFFFFFFFFFU };
+
+    /**
+     * @brief Performance counter frequency.
+     */
+    ::LONGLONG frequency_{ 0 };
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_HEAPREPLAYER_HPP_
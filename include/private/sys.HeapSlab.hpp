@@ -0,0 +1,426 @@
+/**
+ * @file      sys.HeapSlab.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_HEAPSLAB_HPP_
+#define SYS_HEAPSLAB_HPP_
+
+#include "sys.NonCopyable.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_HEAP_SLAB_REGION_SIZE
+/**
+ * @brief Size in bytes of address space reserved for slabs.
+ */
+#define EOOS_GLOBAL_SYS_HEAP_SLAB_REGION_SIZE ( (sizeof(void*) == 8U) ? 0x40000000U : 0x04000000U )
+#endif // EOOS_GLOBAL_SYS_HEAP_SLAB_REGION_SIZE
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class HeapSlab.
+ * @brief Segregated size-class slab memory allocator.
+ *
+ * The allocator reserves a contiguous region of address space and commits
+ * it on demand by slabs of SLAB_SIZE bytes. Each slab is dedicated to one
+ * size class and is split into equal blocks linked into a free list of the class,
+ * thus allocating and freeing a block takes constant time.
+ *
+ * Each thread keeps a cache of free blocks per size class, so most calls
+ * are served without locking. The thread cache is refilled from and flushed to
+ * the free lists of the classes, which play role of a shared depot, by batches.
+ *
+ * A slab created to refill a thread cache is owned by the cache, and its blocks
+ * never get to the depot but stay in the cache. A thread freeing a block of a slab
+ * owned by another cache pushes the block to a lock-free remote queue of the owner,
+ * and the owner reclaims all queued blocks at once when it runs out of blocks.
+ * Thus blocks passed from a producer to a consumer thread return to the producer
+ * without locking the depot. A cache of an exited thread is kept with its owned
+ * blocks and its remote queue and adopted by a new thread.
+ */
+class HeapSlab : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Maximum size of a block in bytes served by the allocator.
+     */
+    static const size_t MAX_BLOCK_SIZE{ 2048U };
+
+    /**
+     * @brief Maximum alignment in bytes which blocks of the size class of the alignment and greater have.
+     */
+    static const size_t MAX_ALIGNMENT{ 64U };
+
+    /**
+     * @brief Constructor.
+     */
+    HeapSlab() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~HeapSlab() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @brief Allocates memory.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    void* allocate(size_t size) noexcept;
+
+    /**
+     * @brief Frees allocated memory.
+     *
+     * @param ptr Address of memory block allocated by this allocator.
+     */
+    void free(void* ptr) noexcept;
+
+    /**
+     * @brief Tests if memory belongs to this allocator.
+     *
+     * @param ptr Address of memory block.
+     * @return True if the memory has been allocated by this allocator.
+     */
+    bool_t isOwned(void const* ptr) const noexcept;
+
+    /**
+     * @brief Returns usable size of a block.
+     *
+     * @param ptr Address of memory block allocated by this allocator.
+     * @return Number of bytes which can be used in the block.
+     */
+    size_t getSize(void const* ptr) const noexcept;
+
+private:
+
+    /**
+     * @brief Number of size classes being powers of two from MIN_BLOCK_SIZE to MAX_BLOCK_SIZE.
+     */
+    static const int32_t NUMBER_OF_CLASSES{ 8 };
+
+    /**
+     * @struct Block
+     * @brief Free memory block.
+     */
+    struct Block
+    {
+        /**
+         * @brief Next free block.
+         */
+        Block* next;
+    };
+
+    /**
+     * @struct Magazine
+     * @brief Thread cache of free blocks of one size class.
+     */
+    struct Magazine
+    {
+        /**
+         * @brief Head of the cached blocks list.
+         */
+        Block* head;
+
+        /**
+         * @brief Number of the cached blocks.
+         */
+        int32_t count;
+
+        /**
+         * @brief Head of the list of free blocks of slabs owned by the cache.
+         *
+         * The blocks are never flushed to the depot, thus a block of an owned slab
+         * is only allocated by the owner and frees of it by the owner stay local.
+         */
+        Block* owned;
+    };
+
+    /**
+     * @struct Cache
+     * @brief Thread cache of free blocks.
+     */
+    struct Cache
+    {
+        /**
+         * @brief The allocator the cache belongs to.
+         */
+        HeapSlab* heap;
+
+        /**
+         * @brief Next cache in the list of caches of exited threads.
+         */
+        Cache* next;
+
+        /**
+         * @brief Head of the remote queue of blocks freed by other threads.
+         *
+         * The queue is kept in its own cache line to not slow down the owner thread
+         * working with the magazines while other threads push blocks to the queue.
+         */
+        alignas(MAX_ALIGNMENT) ::PVOID volatile remote;
+
+        /**
+         * @brief Magazines of size classes.
+         */
+        alignas(MAX_ALIGNMENT) Magazine magazines[NUMBER_OF_CLASSES];
+    };
+
+    /**
+     * @struct Slab
+     * @brief Header of slab placed at the beginning of its memory.
+     */
+    struct Slab
+    {
+        /**
+         * @brief Index of size class the slab is dedicated to.
+         */
+        int32_t index;
+
+        /**
+         * @brief The cache owning the slab, or a null pointer if the slab is shared.
+         */
+        Cache* owner;
+    };
+
+    /**
+     * @struct Class
+     * @brief Size class of blocks.
+     */
+    struct Class
+    {
+        /**
+         * @brief Lock of the class free list.
+         */
+        ::SRWLOCK lock;
+
+        /**
+         * @brief Head of the class free list.
+         */
+        Block* head;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Returns index of size class for a size.
+     *
+     * @param size Number of bytes.
+     * @return Index of the class.
+     */
+    static int32_t getClassIndex(size_t size) noexcept;
+
+    /**
+     * @brief Returns block size of a size class.
+     *
+     * @param index Index of the class.
+     * @return Number of bytes.
+     */
+    static size_t getClassSize(int32_t index) noexcept;
+
+    /**
+     * @brief Returns number of blocks moved between a thread cache and the depot at once.
+     *
+     * @param index Index of the class.
+     * @return Number of blocks.
+     */
+    static int32_t getBatchSize(int32_t index) noexcept;
+
+    /**
+     * @brief Returns slab of a block.
+     *
+     * @param ptr Address of memory block.
+     * @return The slab.
+     */
+    static Slab* getSlab(void const* ptr) noexcept;
+
+    /**
+     * @brief Commits a new slab and links its blocks into the class free list or the owner cache.
+     *
+     * A slab owned by a cache is committed on the NUMA node of the calling thread,
+     * and its blocks are linked into the owned list of the cache magazine.
+     *
+     * @param index Index of size class.
+     * @param owner The cache owning the slab or a null pointer.
+     * @return True if the slab has been created.
+     */
+    bool_t createSlab(int32_t index, Cache* owner) noexcept;
+
+    /**
+     * @brief Allocates a block from the depot.
+     *
+     * @param index Index of size class.
+     * @return Allocated block or a null pointer.
+     */
+    Block* allocateBlock(int32_t index) noexcept;
+
+    /**
+     * @brief Frees a block to the depot.
+     *
+     * @param block The block.
+     * @param index Index of size class.
+     */
+    void freeBlock(Block* block, int32_t index) noexcept;
+
+    /**
+     * @brief Returns the calling thread cache creating it if it does not exist.
+     *
+     * @return The cache or a null pointer.
+     */
+    Cache* getCache() noexcept;
+
+    /**
+     * @brief Creates a cache or adopts a cache of an exited thread.
+     *
+     * @return The cache or a null pointer.
+     */
+    Cache* createCache() noexcept;
+
+    /**
+     * @brief Puts a block to a thread cache flushing the magazine if it overflows.
+     *
+     * @param cache The cache.
+     * @param block The block.
+     * @param index Index of size class.
+     */
+    void cacheBlock(Cache& cache, Block* block, int32_t index) noexcept;
+
+    /**
+     * @brief Pushes a block to the remote queue of its owner cache.
+     *
+     * @param owner The owner cache.
+     * @param block The block.
+     */
+    static void pushRemote(Cache& owner, Block* block) noexcept;
+
+    /**
+     * @brief Reclaims all blocks of the remote queue of a thread cache to its owned lists.
+     *
+     * @param cache The cache.
+     */
+    void reclaim(Cache& cache) noexcept;
+
+    /**
+     * @brief Refills a magazine from the depot by a batch of blocks.
+     *
+     * If the depot is empty, a new slab owned by the cache is created.
+     *
+     * @param cache The cache of the magazine.
+     * @param index Index of size class.
+     */
+    void refill(Cache& cache, int32_t index) noexcept;
+
+    /**
+     * @brief Flushes blocks of a magazine to the depot.
+     *
+     * @param magazine The magazine.
+     * @param index Index of size class.
+     * @param count Number of blocks to flush.
+     */
+    void flush(Magazine& magazine, int32_t index, int32_t count) noexcept;
+
+    /**
+     * @brief Flushes blocks of shared slabs of a thread cache and keeps the cache for adoption.
+     *
+     * The function is called by the system when a thread exits.
+     *
+     * @param data The cache.
+     */
+    static void WINAPI destroyCache(::PVOID data);
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    HeapSlab(HeapSlab const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    HeapSlab& operator=(HeapSlab const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    HeapSlab(HeapSlab&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    HeapSlab& operator=(HeapSlab&&) & noexcept = delete;
+
+    /**
+     * @brief Size of one slab in bytes which is equal to Windows allocation granularity.
+     */
+    static const size_t SLAB_SIZE{ 0x00010000U };
+
+    /**
+     * @brief Size of slab header in bytes keeping blocks aligned to cache line.
+     */
+    static const size_t SLAB_HEADER_SIZE{ MAX_ALIGNMENT };
+
+    /**
+     * @brief Size of the least size class in bytes.
+     */
+    static const size_t MIN_BLOCK_SIZE{ 16U };
+
+    /**
+     * @brief Total size in bytes of blocks moved between a thread cache and the depot at once.
+     */
+    static const size_t BATCH_BYTES{ 8192U };
+
+    /**
+     * @brief Size of reserved region in bytes.
+     */
+    static const size_t REGION_SIZE{ EOOS_GLOBAL_SYS_HEAP_SLAB_REGION_SIZE };
+
+    /**
+     * @brief Reserved region of slabs.
+     */
+    ucell_t* region_{ NULLPTR };
+
+    /**
+     * @brief Number of slabs committed in the region.
+     */
+    volatile ::LONG numberOfSlabs_{ 0 };
+
+    /**
+     * @brief Fiber local storage index of thread caches.
+     */
+    ::DWORD cacheIndex_{ FLS_OUT_OF_INDEXES };
+
+    /**
+     * @brief Size classes.
+     */
+    Class classes_[NUMBER_OF_CLASSES];
+
+    /**
+     * @brief Lock of the list of caches of exited threads.
+     */
+    ::SRWLOCK orphansLock_;
+
+    /**
+     * @brief List of caches of exited threads.
+     */
+    Cache* orphans_{ NULLPTR };
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_HEAPSLAB_HPP_
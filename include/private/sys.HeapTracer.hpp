@@ -0,0 +1,172 @@
+/**
+ * @file      sys.HeapTracer.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_HEAPTRACER_HPP_
+#define SYS_HEAPTRACER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.HeapTrace.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_HEAP_TRACE_SIZE
+/**
+ * @brief Number of records of the heap trace ring buffer being a power of two.
+ */
+#define EOOS_GLOBAL_SYS_HEAP_TRACE_SIZE (0x00010000U)
+#endif // EOOS_GLOBAL_SYS_HEAP_TRACE_SIZE
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class HeapTracer.
+ * @brief Heap allocation trace recording.
+ *
+ * The heap reports allocations and frees to the tracer only if the system is built
+ * with EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE, otherwise the heap does no extra work
+ * and the tracer does not reserve the ring buffer memory. A record place in the ring buffer
+ * is taken by one atomic increment, so threads record without locking.
+ */
+class HeapTracer : public NonCopyable<NoAllocator>, public HeapTrace
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    HeapTracer() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~HeapTracer() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapTrace::isEnabled()
+     */
+    bool_t isEnabled() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapTrace::start()
+     */
+    bool_t start() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapTrace::stop()
+     */
+    void stop() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapTrace::getFrequency()
+     */
+    uint64_t getFrequency() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapTrace::getNumberOfRecords()
+     */
+    uint64_t getNumberOfRecords() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapTrace::getRecords(Record*, size_t)
+     */
+    size_t getRecords(Record* records, size_t count) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::HeapTrace::reset()
+     */
+    void reset() noexcept override;
+
+    /**
+     * @brief Records an allocation if recording is going on.
+     *
+     * @param ptr  Address of the allocated block.
+     * @param size Requested number of bytes.
+     */
+    void recordAllocation(void const* ptr, size_t size) noexcept;
+
+    /**
+     * @brief Records a free if recording is going on.
+     *
+     * @param ptr Address of the freed block.
+     */
+    void recordFree(void const* ptr) noexcept;
+
+private:
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Records an operation.
+     *
+     * @param ptr  Address of the block.
+     * @param size Size of the record.
+     */
+    void record(void const* ptr, uint32_t size) noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    HeapTracer(HeapTracer const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    HeapTracer& operator=(HeapTracer const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    HeapTracer(HeapTracer&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    HeapTracer& operator=(HeapTracer&&) & noexcept = delete;
+
+    /**
+     * @brief Number of records of the ring buffer.
+     */
+    static const size_t CAPACITY{ EOOS_GLOBAL_SYS_HEAP_TRACE_SIZE };
+
+    static_assert((CAPACITY & (CAPACITY - 1U)) == 0U, "Capacity of the ring buffer must be a power of two");
+
+    /**
+     * @brief The ring buffer.
+     */
+    Record* records_{ NULLPTR };
+
+    /**
+     * @brief Number of records done from the last reset.
+     */
+    volatile ::LONG64 position_{ 0 };
+
+    /**
+     * @brief Recording is going on.
+     */
+    volatile ::LONG isRecording_{ 0 };
+
+    /**
+     * @brief Performance counter frequency.
+     */
+    ::LONGLONG frequency_{ 0 };
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_HEAPTRACER_HPP_
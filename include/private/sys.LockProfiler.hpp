@@ -0,0 +1,307 @@
+/**
+ * @file      sys.LockProfiler.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_LOCKPROFILER_HPP_
+#define SYS_LOCKPROFILER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.LockStatistics.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class LockProfiler.
+ * @brief Lock contention profiler.
+ *
+ * Each profiled lock embeds a probe, which links itself into the list of probes of the profiler
+ * for the lock lifetime. Locks report to their probes only if the system is built with
+ * EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER, otherwise locks have no probes.
+ */
+class LockProfiler : public NonCopyable<NoAllocator>, public LockStatistics
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @class Probe.
+     * @brief Contention counters of one lock.
+     */
+    class Probe : public NonCopyable<NoAllocator>
+    {
+        using Parent = NonCopyable<NoAllocator>;
+        friend class LockProfiler;
+
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param lock The lock.
+         * @param type Type of the lock.
+         */
+        Probe(void const* lock, Type type) noexcept;
+
+        /**
+         * @brief Destructor.
+         */
+        ~Probe() noexcept override;
+
+        /**
+         * @brief Accounts a contention before waiting for the lock.
+         *
+         * @return Performance counter value of the wait beginning.
+         */
+        ::LONGLONG beginWait() noexcept;
+
+        /**
+         * @brief Accounts the end of waiting for the lock.
+         *
+         * @param begin Performance counter value of the wait beginning.
+         */
+        void endWait(::LONGLONG begin) noexcept;
+
+        /**
+         * @brief Accounts an acquisition of the lock.
+         *
+         * A recursive acquisition by the owner thread does not restart the hold time.
+         */
+        void acquire() noexcept;
+
+        /**
+         * @brief Accounts an acquisition of a lock which has no owner.
+         *
+         * Permits of a semaphore can be released by any thread, so neither the owner
+         * nor the hold time are accounted. Many permits acquired at once are one acquisition.
+         */
+        void take() noexcept;
+
+        /**
+         * @brief Accounts a release of the lock by the thread which has acquired it.
+         *
+         * The hold time is accounted on the outermost release of a recursively acquired lock.
+         */
+        void release() noexcept;
+
+    private:
+
+        /**
+         * @copydoc eoos::Object::Object(Object const&)
+         */
+        Probe(Probe const&) noexcept = delete;
+
+        /**
+         * @copydoc eoos::Object::operator=(Object const&)
+         */
+        Probe& operator=(Probe const&) noexcept = delete;
+
+        /**
+         * @copydoc eoos::Object::Object(Object&&)
+         */
+        Probe(Probe&&) noexcept = delete;
+
+        /**
+         * @copydoc eoos::Object::operator=(Object&&)
+         */
+        Probe& operator=(Probe&&) & noexcept = delete;
+
+        /**
+         * @brief The lock.
+         */
+        void const* const lock_;
+
+        /**
+         * @brief Type of the lock.
+         */
+        Type const type_;
+
+        /**
+         * @brief Previous probe in the list.
+         */
+        Probe* prev_{ NULLPTR };
+
+        /**
+         * @brief Next probe in the list.
+         */
+        Probe* next_{ NULLPTR };
+
+        /**
+         * @brief Identifier of the thread which has acquired the lock last.
+         */
+        volatile ::LONG owner_{ 0 };
+
+        /**
+         * @brief Identifier of the thread which has owned the lock at the last contention.
+         */
+        volatile ::LONG contendedOwner_{ 0 };
+
+        /**
+         * @brief Number of acquisitions.
+         */
+        volatile ::LONG64 acquisitions_{ 0 };
+
+        /**
+         * @brief Number of contentions.
+         */
+        volatile ::LONG64 contentions_{ 0 };
+
+        /**
+         * @brief Total wait time in performance counter ticks.
+         */
+        volatile ::LONG64 waitTime_{ 0 };
+
+        /**
+         * @brief Maximum wait time in performance counter ticks.
+         */
+        volatile ::LONG64 maxWaitTime_{ 0 };
+
+        /**
+         * @brief Total hold time in performance counter ticks.
+         */
+        volatile ::LONG64 holdTime_{ 0 };
+
+        /**
+         * @brief Performance counter value of the last acquisition by a new owner.
+         */
+        ::LONGLONG acquireTime_{ 0 };
+
+        /**
+         * @brief Number of acquisitions by the owner not released yet changed only by the owner.
+         */
+        int32_t depth_{ 0 };
+
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    LockProfiler() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~LockProfiler() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::LockStatistics::isEnabled()
+     */
+    bool_t isEnabled() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::LockStatistics::getNumberOfLocks()
+     */
+    size_t getNumberOfLocks() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::LockStatistics::getCounters(Counters*, size_t)
+     */
+    size_t getCounters(Counters* counters, size_t count) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::LockStatistics::dump(api::OutStream<char_t>&)
+     */
+    void dump(api::OutStream<char_t>& stream) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::LockStatistics::reset()
+     */
+    void reset() noexcept override;
+
+private:
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Fills counters of a probe.
+     *
+     * @param probe    The probe.
+     * @param counters The counters to fill.
+     */
+    void getCounters(Probe const& probe, Counters& counters) const noexcept;
+
+    /**
+     * @brief Converts performance counter ticks to microseconds.
+     *
+     * @param ticks Number of ticks.
+     * @return Number of microseconds.
+     */
+    uint64_t toMicroseconds(::LONG64 const volatile& ticks) const noexcept;
+
+    /**
+     * @brief Prints an unsigned value.
+     *
+     * @param stream Stream to print to.
+     * @param value  The value.
+     * @param base   Base of the value representation from 2 to 16.
+     */
+    static void print(api::OutStream<char_t>& stream, uint64_t value, uint32_t base) noexcept;
+
+    /**
+     * @brief Adds a probe to the list.
+     *
+     * @param probe The probe.
+     */
+    static void attach(Probe& probe) noexcept;
+
+    /**
+     * @brief Removes a probe from the list.
+     *
+     * @param probe The probe.
+     */
+    static void detach(Probe& probe) noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    LockProfiler(LockProfiler const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    LockProfiler& operator=(LockProfiler const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    LockProfiler(LockProfiler&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    LockProfiler& operator=(LockProfiler&&) & noexcept = delete;
+
+    /**
+     * @brief Lock of the list of probes.
+     */
+    static ::SRWLOCK lock_;
+
+    /**
+     * @brief List of probes of existing locks.
+     */
+    static Probe* probes_;
+
+    /**
+     * @brief Performance counter frequency.
+     */
+    ::LONGLONG frequency_{ 0 };
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_LOCKPROFILER_HPP_
@@ -0,0 +1,104 @@
+/**
+ * @file      sys.MultiWaiter.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_MULTIWAITER_HPP_
+#define SYS_MULTIWAITER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.MultiWait.hpp"
+#include "sys.Timeout.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class MultiWaiter.
+ * @brief Waiter for many objects at once.
+ *
+ * The objects are waited for by one Windows wait for multiple kernel objects. A timed wait
+ * for any object waits for the high-resolution timer together with the objects, thus the number
+ * of objects is one less than MAXIMUM_WAIT_OBJECTS.
+ */
+class MultiWaiter : public NonCopyable<NoAllocator>, public MultiWait
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    MultiWaiter() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~MultiWaiter() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::MultiWait::waitAny(Waitable* const*,int32_t)
+     */
+    int32_t waitAny(Waitable* const* objects, int32_t number) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::MultiWait::waitAny(Waitable* const*,int32_t,uint64_t)
+     */
+    int32_t waitAny(Waitable* const* objects, int32_t number, uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::MultiWait::waitAll(Waitable* const*,int32_t)
+     */
+    bool_t waitAll(Waitable* const* objects, int32_t number) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::MultiWait::waitAll(Waitable* const*,int32_t,uint64_t)
+     */
+    bool_t waitAll(Waitable* const* objects, int32_t number, uint64_t timeoutUs) noexcept override;
+
+private:
+
+    /**
+     * @brief Waits for objects.
+     *
+     * @param objects The objects.
+     * @param number  Number of the objects.
+     * @param isAll   Wait for all the objects, otherwise wait for any object.
+     * @param timeout The timeout, or NULLPTR to wait infinitely.
+     * @return Index of the object which has fired, or of the last object if all of them have fired, or NONE.
+     */
+    int32_t wait(Waitable* const* objects, int32_t number, bool_t isAll, Timeout* timeout) noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    MultiWaiter(MultiWaiter const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    MultiWaiter& operator=(MultiWaiter const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    MultiWaiter(MultiWaiter&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    MultiWaiter& operator=(MultiWaiter&&) & noexcept = delete;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_MULTIWAITER_HPP_
@@ -1,13 +1,15 @@
 /**
  * @file      sys.Mutex.hpp
  * @author    Sergey Baigudin, sergey@baigudin.software
- * @copyright 2022, Sergey Baigudin, Baigudin Software
+ * @copyright 2022-2023, Sergey Baigudin, Baigudin Software
  */
 #ifndef SYS_MUTEX_HPP_
 #define SYS_MUTEX_HPP_
 
 #include "sys.NonCopyable.hpp"
-#include "api.Mutex.hpp"
+#include "sys.TimedMutex.hpp"
+#include "sys.LockProfiler.hpp"
+#include "sys.TimedLockWaiter.hpp"
 
 namespace eoos
 {
@@ -17,13 +19,25 @@ namespace sys
 /**
  * @class Mutex.
  * @brief Mutex class.
+ *
+ * A mutex spins a fixed number of times before waiting on the kernel object, or it adapts
+ * the number of spins to measured contention. An adaptive mutex moves its spin budget to twice
+ * the number of spins which a successful spinning has taken, and decreases the budget
+ * toward zero if spinning has failed and the thread has waited on the kernel object.
+ *
+ * A critical section has no timed wait, so threads locking the mutex with a timeout
+ * sleep on the timed lock waiter until an unlock or the deadline.
+ *
+ * If the system is built with EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER, the mutex reports
+ * its acquisitions, contentions, wait and hold times to the lock profiler.
  * 
  * @tparam A Heap memory allocator class.
  */
 template <class A>
-class Mutex : public NonCopyable<A>, public api::Mutex
+class Mutex : public NonCopyable<A>, public TimedMutex
 {
     using Parent = NonCopyable<A>;
+    friend class TimedLockWaiter;
 
 public:
 
@@ -32,6 +46,14 @@ public:
      */
     Mutex() noexcept;
 
+    /**
+     * @brief Constructor.
+     *
+     * @param spinCount  Number of spins before waiting, or the maximum number if the mutex is adaptive.
+     * @param isAdaptive Adapt the number of spins to contention.
+     */
+    Mutex(uint32_t spinCount, bool_t isAdaptive) noexcept;
+
     /**
      * @brief Destructor.
      */
@@ -52,6 +74,16 @@ public:
      */
     bool_t lock() noexcept override;
 
+    /**
+     * @copydoc eoos::sys::TimedMutex::lock(uint64_t)
+     */
+    bool_t lock(uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::TimedMutex::isLockedRecursively()
+     */
+    bool_t isLockedRecursively() const noexcept override;
+
     /**
      * @copydoc eoos::api::Mutex::unlock()
      */
@@ -64,7 +96,44 @@ private:
      *
      * @return True if object has been constructed successfully.
      */
-    bool_t construct() const noexcept;
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Tries to take the critical section once.
+     *
+     * @return True if the critical section has been taken.
+     */
+    bool_t tryTake() noexcept;
+
+    /**
+     * @brief Accounts a lock of the mutex by the calling thread which has taken the critical section.
+     */
+    void own() noexcept;
+
+    /**
+     * @brief Accounts an unlock of the mutex by the owner thread before it leaves the critical section.
+     */
+    void disown() noexcept;
+
+    /**
+     * @brief Enters the critical section spinning as the mutex is configured.
+     */
+    void enter() noexcept;
+
+    /**
+     * @brief Locks the mutex spinning the adaptive number of times before waiting.
+     */
+    void lockAdaptive() noexcept;
+
+    /**
+     * @brief Returns the spin budget decayed after spinning has failed to take the lock.
+     *
+     * The budget is decreased by one eighth rounded up, so it reaches zero if spinning keeps failing.
+     *
+     * @param budget The spin budget.
+     * @return The decayed budget.
+     */
+    static constexpr int32_t getDecayedBudget(int32_t budget) noexcept;
     
     /**
      * @copydoc eoos::Object::Object(Object const&)
@@ -96,12 +165,63 @@ private:
      */    
     ::LPCRITICAL_SECTION const pcs_{ &cs_ };    
 
+    /**
+     * @brief Default number of spins.
+     */
+    static const uint32_t DEFAULT_SPIN_COUNT{ 4000U };
+
+    /**
+     * @brief Number of spins before waiting, or the maximum number if the mutex is adaptive.
+     */
+    int32_t const spinCount_;
+
+    /**
+     * @brief Adapt the number of spins to contention.
+     */
+    bool_t const isAdaptive_;
+
+    /**
+     * @brief Current spin budget of the adaptive mutex changed only by the lock owner.
+     */
+    int32_t spinBudget_{ 0 };
+
+    /**
+     * @brief Waiter of threads locking the mutex with a timeout.
+     */
+    TimedLockWaiter timedWaiter_;
+
+    /**
+     * @brief Identifier of the thread which owns the mutex, or zero if the mutex is unlocked.
+     */
+    volatile ::LONG owner_{ 0 };
+
+    /**
+     * @brief Number of times the owner thread has locked the mutex, which is changed only by the owner.
+     */
+    int32_t depth_{ 0 };
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
+    /**
+     * @brief Contention counters of the mutex.
+     */
+    LockProfiler::Probe probe_{ this, LockStatistics::Type::MUTEX };
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
 };
 
 template <class A>
 Mutex<A>::Mutex() noexcept
+    : Mutex(DEFAULT_SPIN_COUNT, false) {
+}
+
+template <class A>
+Mutex<A>::Mutex(uint32_t spinCount, bool_t isAdaptive) noexcept
     : NonCopyable<A>()
-    , api::Mutex() {
+    , TimedMutex()
+    , spinCount_( (spinCount < 0x7FFFFFFFU) ? static_cast<int32_t>(spinCount) : 0x7FFFFFFF )
+    , isAdaptive_( isAdaptive ) {
     bool_t const isConstructed{ construct() };
     setConstructed( isConstructed );
 }
@@ -124,7 +244,14 @@ bool_t Mutex<A>::tryLock() noexcept try
     bool_t res{ false };
     if( isConstructed() )
     {
-        res = ::TryEnterCriticalSection(pcs_) != 0;
+        res = tryTake();
+        if(res == true)
+        {
+            own();
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            probe_.acquire();
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        }
     }
     return res;
 } catch (...) { ///< UT Justified Branch: OS dependency
@@ -137,7 +264,18 @@ bool_t Mutex<A>::lock() noexcept try
     bool_t res{ false };
     if( isConstructed() )
     {
-        ::EnterCriticalSection(pcs_);
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        if( ::TryEnterCriticalSection(pcs_) == 0 )
+        {
+            ::LONGLONG const begin{ probe_.beginWait() };
+            enter();
+            probe_.endWait(begin);
+        }
+        probe_.acquire();
+        #else
+        enter();
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        own();
         res = true;
     }
     return res;
@@ -145,13 +283,62 @@ bool_t Mutex<A>::lock() noexcept try
     return false;
 }
 
+template <class A>
+bool_t Mutex<A>::lock(uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        res = tryTake();
+        if(res == false)
+        {
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            ::LONGLONG const begin{ probe_.beginWait() };
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            Timeout timeout( timeoutUs );
+            res = timedWaiter_.wait(*this, timeout);
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            probe_.endWait(begin);
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        }
+        if(res == true)
+        {
+            own();
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            probe_.acquire();
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t Mutex<A>::isLockedRecursively() const noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        // Only the calling thread sets its own identifier, so the depth is read by the owner only
+        ::LONG const thread{ static_cast< ::LONG >( ::GetCurrentThreadId() ) };
+        res = (owner_ == thread) && (depth_ > 1);
+    }
+    return res;
+}
+
 template <class A>
 bool_t Mutex<A>::unlock() noexcept try
 {
     bool_t res{ false };    
     if( isConstructed() )
     {
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        probe_.release();
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        disown();
         ::LeaveCriticalSection(pcs_);
+        timedWaiter_.notify();
         res = true;
     }
     return res;
@@ -160,12 +347,13 @@ bool_t Mutex<A>::unlock() noexcept try
 }
 
 template <class A>
-bool_t Mutex<A>::construct() const noexcept try
+bool_t Mutex<A>::construct() noexcept try
 {
     bool_t res{ false };
     if( isConstructed() )
     {
-        ::DWORD const spinCount{ 4000U };
+        // The adaptive mutex spins itself, so the critical section waits at once
+        ::DWORD const spinCount{ isAdaptive_ ? 0U : static_cast< ::DWORD >(spinCount_) };
         ::BOOL const isInitialize{ ::InitializeCriticalSectionAndSpinCount(pcs_, spinCount) };
         if(isInitialize != 0)
         {
@@ -177,6 +365,81 @@ bool_t Mutex<A>::construct() const noexcept try
     return false;
 }
 
+template <class A>
+bool_t Mutex<A>::tryTake() noexcept
+{
+    return ::TryEnterCriticalSection(pcs_) != 0;
+}
+
+template <class A>
+void Mutex<A>::own() noexcept
+{
+    owner_ = static_cast< ::LONG >( ::GetCurrentThreadId() );
+    depth_++;
+}
+
+template <class A>
+void Mutex<A>::disown() noexcept
+{
+    if(depth_ > 0)
+    {
+        depth_--;
+    }
+    if(depth_ == 0)
+    {
+        owner_ = 0;
+    }
+}
+
+template <class A>
+void Mutex<A>::enter() noexcept
+{
+    if(isAdaptive_)
+    {
+        lockAdaptive();
+    }
+    else
+    {
+        ::EnterCriticalSection(pcs_);
+    }
+}
+
+template <class A>
+constexpr int32_t Mutex<A>::getDecayedBudget(int32_t budget) noexcept
+{
+    return budget - (budget / 8) - ( ((budget % 8) != 0) ? 1 : 0 );
+}
+
+template <class A>
+void Mutex<A>::lockAdaptive() noexcept
+{
+    // Let the budget grow from zero when contention appears
+    int32_t limit{ (spinBudget_ * 2) + 16 };
+    if(limit > spinCount_)
+    {
+        limit = spinCount_;
+    }
+    int32_t spins{ 0 };
+    bool_t isLocked{ ::TryEnterCriticalSection(pcs_) != 0 };
+    while( (!isLocked) && (spins < limit) )
+    {
+        ::YieldProcessor();
+        spins++;
+        isLocked = ::TryEnterCriticalSection(pcs_) != 0;
+    }
+    static_assert( (getDecayedBudget(1) == 0) && (getDecayedBudget(0x7FFFFFFF) < 0x7FFFFFFF), "Failed spinning must let the spin budget decay to zero" );
+    if(isLocked)
+    {
+        // Aim at twice the spins which have been enough
+        spinBudget_ += ((spins * 2) - spinBudget_) / 8;
+    }
+    else
+    {
+        ::EnterCriticalSection(pcs_);
+        spinBudget_ = getDecayedBudget(spinBudget_);
+    }
+}
+
 } // namespace sys
 } // namespace eoos
 #endif // SYS_MUTEX_HPP_
@@ -0,0 +1,508 @@
+/**
+ * @file      sys.MutexFair.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_MUTEXFAIR_HPP_
+#define SYS_MUTEXFAIR_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.TimedMutex.hpp"
+#include "sys.TimedLockWaiter.hpp"
+#include "sys.LockProfiler.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class MutexFair.
+ * @brief Fair queue mutex class.
+ *
+ * The mutex is an MCS queue lock, which queues waiting threads in the FIFO order. Each waiting
+ * thread spins on its own queue node on its stack, and only the thread at the head of the queue
+ * spins on the lock word, thus a release of the mutex touches the cache lines of two threads
+ * at most. A thread takes the mutex without queueing only if the queue is empty. A thread which
+ * has spun the given number of times blocks on a kernel event, the head of the queue blocks
+ * on the event of the mutex and other threads block on their own events, which each thread
+ * creates once and keeps in its fiber local storage until it exits.
+ *
+ * The mutex is not recursive and it must be unlocked by the thread which has locked it.
+ * A queued thread cannot leave the queue, so a timed lock does not queue. It sleeps on
+ * the timed lock waiter and competes with the head of the queue on each unlock until the deadline.
+ *
+ * If the system is built with EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER, the mutex reports
+ * its acquisitions, contentions, wait and hold times to the lock profiler, and the wait
+ * of a queued thread lasts from queueing until it takes the lock word.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class MutexFair : public NonCopyable<A>, public TimedMutex
+{
+    using Parent = NonCopyable<A>;
+    friend class TimedLockWaiter;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param spinCount Number of spins before blocking.
+     */
+    explicit MutexFair(uint32_t spinCount) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~MutexFair() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    bool_t tryLock() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    bool_t lock() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::TimedMutex::lock(uint64_t)
+     */
+    bool_t lock(uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::TimedMutex::isLockedRecursively()
+     */
+    bool_t isLockedRecursively() const noexcept override;
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    bool_t unlock() noexcept override;
+
+private:
+
+    /**
+     * @struct Node
+     * @brief Queue node of a waiting thread.
+     */
+    struct Node
+    {
+        /**
+         * @brief Next node in the queue.
+         */
+        ::PVOID volatile next;
+
+        /**
+         * @brief State of the waiting thread.
+         */
+        ::LONG volatile state;
+
+        /**
+         * @brief Event the thread blocks on.
+         */
+        ::HANDLE event;
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Tries to take the lock word.
+     *
+     * @return True if the lock word has been taken.
+     */
+    bool_t tryTake() noexcept;
+
+    /**
+     * @brief Waits until the node becomes the head of the queue.
+     *
+     * @param node The node of the calling thread.
+     */
+    void waitHead(Node& node) const noexcept;
+
+    /**
+     * @brief Takes the lock word by the head of the queue.
+     */
+    void takeHead() noexcept;
+
+    /**
+     * @brief Makes the node the head of the queue.
+     *
+     * @param node The next node of the queue.
+     */
+    static void grant(Node& node) noexcept;
+
+    /**
+     * @brief Returns the event of the calling thread to block on.
+     *
+     * @return The event, or NULLPTR if the thread has no event.
+     */
+    static ::HANDLE getEvent() noexcept;
+
+    /**
+     * @brief Closes the event of a thread.
+     *
+     * The function is called by the system when a thread exits.
+     *
+     * @param data The event.
+     */
+    static void WINAPI destroyEvent(::PVOID data);
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    MutexFair(MutexFair const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    MutexFair& operator=(MutexFair const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    MutexFair(MutexFair&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    MutexFair& operator=(MutexFair&&) & noexcept = delete;
+
+    /**
+     * @brief The node thread spins or the lock word is unlocked.
+     */
+    static const ::LONG WAITING{ 0 };
+
+    /**
+     * @brief The node is the head of the queue or the lock word is locked.
+     */
+    static const ::LONG READY{ 1 };
+
+    /**
+     * @brief The node thread blocks on its event or the head blocks on the event of the mutex.
+     */
+    static const ::LONG PARKED{ 2 };
+
+    /**
+     * @brief Lock word, which is READY if the mutex is locked and also PARKED if the head blocks.
+     */
+    ::LONG volatile lock_{ WAITING };
+
+    /**
+     * @brief The last node of the queue.
+     */
+    ::PVOID volatile tail_{ NULLPTR };
+
+    /**
+     * @brief The event the head of the queue blocks on.
+     */
+    ::HANDLE event_{ NULLPTR };
+
+    /**
+     * @brief Number of spins before blocking.
+     */
+    uint32_t const spinCount_;
+
+    /**
+     * @brief Waiter of threads locking the mutex with a timeout.
+     */
+    TimedLockWaiter timedWaiter_;
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
+    /**
+     * @brief Contention counters of the mutex.
+     */
+    LockProfiler::Probe probe_{ this, LockStatistics::Type::MUTEX };
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
+};
+
+template <class A>
+MutexFair<A>::MutexFair(uint32_t spinCount) noexcept
+    : NonCopyable<A>()
+    , TimedMutex()
+    , spinCount_( spinCount ) {
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+template <class A>
+MutexFair<A>::~MutexFair() noexcept
+{
+    if(event_ != NULLPTR)
+    {
+        static_cast<void>( ::CloseHandle(event_) );
+        event_ = NULLPTR;
+    }
+}
+
+template <class A>
+bool_t MutexFair<A>::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t MutexFair<A>::tryLock() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (tail_ == NULLPTR) )
+    {
+        res = tryTake();
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        if(res == true)
+        {
+            probe_.acquire();
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t MutexFair<A>::lock() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        if( (tail_ == NULLPTR) && tryTake() )
+        {
+            res = true;
+        }
+        else
+        {
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            ::LONGLONG const begin{ probe_.beginWait() };
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            Node node{ NULLPTR, WAITING, NULLPTR };
+            Node* const prev{ static_cast<Node*>( ::InterlockedExchangePointer(&tail_, &node) ) };
+            if(prev != NULLPTR)
+            {
+                static_cast<void>( ::InterlockedExchangePointer(&prev->next, &node) );
+                waitHead(node);
+            }
+            takeHead();
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            probe_.endWait(begin);
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            // Leave the queue passing the head to the next node
+            Node* next{ static_cast<Node*>(node.next) };
+            if(next == NULLPTR)
+            {
+                if( ::InterlockedCompareExchangePointer(&tail_, NULLPTR, &node) != &node )
+                {
+                    // A thread is linking its node to this one
+                    while(node.next == NULLPTR)
+                    {
+                        ::YieldProcessor();
+                    }
+                    next = static_cast<Node*>(node.next);
+                }
+            }
+            if(next != NULLPTR)
+            {
+                grant(*next);
+            }
+            res = true;
+        }
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        probe_.acquire();
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t MutexFair<A>::lock(uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        res = tryLock();
+        if(res == false)
+        {
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            ::LONGLONG const begin{ probe_.beginWait() };
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            Timeout timeout( timeoutUs );
+            res = timedWaiter_.wait(*this, timeout);
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            probe_.endWait(begin);
+            if(res == true)
+            {
+                probe_.acquire();
+            }
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t MutexFair<A>::isLockedRecursively() const noexcept
+{
+    // The mutex is not recursive
+    return false;
+}
+
+template <class A>
+bool_t MutexFair<A>::unlock() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        probe_.release();
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        ::LONG const state{ ::InterlockedExchange(&lock_, WAITING) };
+        if( (state & PARKED) != 0 )
+        {
+            static_cast<void>( ::SetEvent(event_) );
+        }
+        timedWaiter_.notify();
+        res = true;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t MutexFair<A>::construct() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        // The event is auto-reset as only the head of the queue waits on it
+        event_ = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+        res = event_ != NULLPTR;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t MutexFair<A>::tryTake() noexcept
+{
+    return ( lock_ == WAITING ) && ( ::InterlockedCompareExchange(&lock_, READY, WAITING) == WAITING );
+}
+
+template <class A>
+void MutexFair<A>::waitHead(Node& node) const noexcept
+{
+    for(uint32_t i{0U}; (i<spinCount_) && (node.state == WAITING); i++)
+    {
+        ::YieldProcessor();
+    }
+    if(node.state == WAITING)
+    {
+        // The event shall be set before the node is parked, as the previous thread uses it when it sees the state
+        node.event = getEvent();
+        if(node.event != NULLPTR)
+        {
+            // The auto-reset event is set only for a parked node, so the wait leaves it reset for the next one
+            if( ::InterlockedCompareExchange(&node.state, PARKED, WAITING) == WAITING )
+            {
+                static_cast<void>( ::WaitForSingleObject(node.event, INFINITE) );
+            }
+        }
+        else
+        {   ///< UT Justified Branch: OS dependency
+            while(node.state == WAITING)
+            {
+                static_cast<void>( ::SwitchToThread() );
+            }
+        }
+    }
+}
+
+template <class A>
+void MutexFair<A>::takeHead() noexcept
+{
+    bool_t isTaken{ tryTake() };
+    while(!isTaken)
+    {
+        for(uint32_t i{0U}; (i<spinCount_) && (!isTaken); i++)
+        {
+            ::YieldProcessor();
+            isTaken = tryTake();
+        }
+        // Block until the owner unlocks the mutex, if it is still locked
+        if( (!isTaken) && (::InterlockedCompareExchange(&lock_, READY | PARKED, READY) == READY) )
+        {
+            static_cast<void>( ::WaitForSingleObject(event_, INFINITE) );
+        }
+        if(!isTaken)
+        {
+            isTaken = tryTake();
+        }
+    }
+}
+
+template <class A>
+void MutexFair<A>::grant(Node& node) noexcept
+{
+    // The node is alive until its thread sees it ready, and the thread cannot see it
+    // while it is parked until the event is set
+    if( ::InterlockedExchange(&node.state, READY) == PARKED )
+    {
+        static_cast<void>( ::SetEvent(node.event) );
+    }
+}
+
+template <class A>
+::HANDLE MutexFair<A>::getEvent() noexcept
+{
+    // The index is shared by all the mutexes and kept for the process lifetime
+    static ::DWORD const index{ ::FlsAlloc(&destroyEvent) };
+    ::HANDLE event{ NULLPTR };
+    if(index != FLS_OUT_OF_INDEXES)
+    {
+        event = static_cast< ::HANDLE >( ::FlsGetValue(index) );
+        if(event == NULLPTR)
+        {
+            event = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+            if( (event != NULLPTR) && (::FlsSetValue(index, event) == 0) )
+            {   ///< UT Justified Branch: OS dependency
+                static_cast<void>( ::CloseHandle(event) );
+                event = NULLPTR;
+            }
+        }
+    }
+    return event;
+}
+
+template <class A>
+void WINAPI MutexFair<A>::destroyEvent(::PVOID data)
+{
+    if(data != NULLPTR)
+    {
+        static_cast<void>( ::CloseHandle(static_cast< ::HANDLE >(data)) );
+    }
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_MUTEXFAIR_HPP_
@@ -8,6 +8,14 @@
 
 #include "sys.NonCopyable.hpp"
 #include "api.MutexManager.hpp"
+#include "sys.MutexFactory.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXES
+/**
+ * @brief Number of mutexes which memory is statically allocated.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXES (256)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXES
 
 namespace eoos
 {
@@ -17,8 +25,11 @@ namespace sys
 /**
  * @class MutexManager.
  * @brief Mutex sub-system manager.
+ *
+ * The manager creates mutexes of the default type through the API interface,
+ * and mutexes of other types through the factory interface.
  */
-class MutexManager : public NonCopyable<NoAllocator>, public api::MutexManager
+class MutexManager : public NonCopyable<NoAllocator>, public api::MutexManager, public MutexFactory
 {
     using Parent = NonCopyable<NoAllocator>;
 
@@ -42,7 +53,34 @@ public:
     /**
      * @copydoc eoos::api::MutexManager::create()
      */
-    api::Mutex* create() noexcept override;
+    TimedMutex* create() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::MutexFactory::create(Type)
+     */
+    TimedMutex* create(Type type) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::MutexFactory::create(Type, SpinPolicy const&)
+     */
+    TimedMutex* create(Type type, SpinPolicy const& policy) noexcept override;
+
+    /**
+     * @brief Allocates memory for a mutex.
+     *
+     * The memory is taken from the static pool of mutexes first, and from the heap if the pool is exhausted.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees memory of a mutex.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);
 
 private:
     
@@ -64,7 +102,23 @@ private:
     /**
      * @copydoc eoos::Object::operator=(Object&&)
      */
-    MutexManager& operator=(MutexManager&&) & noexcept = delete;        
+    MutexManager& operator=(MutexManager&&) & noexcept = delete;
+
+    /**
+     * @brief Default spinning policy of mutexes.
+     */
+    static const SpinPolicy DEFAULT_POLICY;
+
+    /**
+     * @struct Pool
+     * @brief Static memory pools of the sub-system resources.
+     */
+    struct Pool;
+
+    /**
+     * @brief The static memory pools.
+     */
+    static Pool pool_;
 
 };
 
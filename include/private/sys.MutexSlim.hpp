@@ -0,0 +1,251 @@
+/**
+ * @file      sys.MutexSlim.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_MUTEXSLIM_HPP_
+#define SYS_MUTEXSLIM_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.TimedMutex.hpp"
+#include "sys.TimedLockWaiter.hpp"
+#include "sys.LockProfiler.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class MutexSlim.
+ * @brief Slim mutex class.
+ *
+ * The mutex is a pointer-sized Windows slim reader/writer lock used in exclusive mode,
+ * which needs neither initialization nor deletion system calls. Unlike Mutex,
+ * the mutex is not recursive and it must be unlocked by the thread which has locked it.
+ *
+ * A slim lock has no timed wait, so the timed lock is waited for by the timed lock waiter.
+ *
+ * If the system is built with EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER, the mutex reports
+ * its acquisitions, contentions, wait and hold times to the lock profiler.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class MutexSlim : public NonCopyable<A>, public TimedMutex
+{
+    using Parent = NonCopyable<A>;
+    friend class TimedLockWaiter;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    MutexSlim() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~MutexSlim() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::api::Mutex::tryLock()
+     */
+    bool_t tryLock() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Mutex::lock()
+     */
+    bool_t lock() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::TimedMutex::lock(uint64_t)
+     */
+    bool_t lock(uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::TimedMutex::isLockedRecursively()
+     */
+    bool_t isLockedRecursively() const noexcept override;
+
+    /**
+     * @copydoc eoos::api::Mutex::unlock()
+     */
+    bool_t unlock() noexcept override;
+
+private:
+
+    /**
+     * @brief Tries to take the slim lock once.
+     *
+     * @return True if the slim lock has been taken.
+     */
+    bool_t tryTake() noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    MutexSlim(MutexSlim const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    MutexSlim& operator=(MutexSlim const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    MutexSlim(MutexSlim&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    MutexSlim& operator=(MutexSlim&&) & noexcept = delete;
+
+    /**
+     * @brief Windows slim reader/writer lock object.
+     */
+    ::SRWLOCK lock_ = SRWLOCK_INIT;
+
+    /**
+     * @brief Waiter of threads locking the mutex with a timeout.
+     */
+    TimedLockWaiter timedWaiter_;
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
+    /**
+     * @brief Contention counters of the mutex.
+     */
+    LockProfiler::Probe probe_{ this, LockStatistics::Type::MUTEX };
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
+};
+
+template <class A>
+MutexSlim<A>::MutexSlim() noexcept
+    : NonCopyable<A>()
+    , TimedMutex() {
+    setConstructed( true );
+}
+
+template <class A>
+bool_t MutexSlim<A>::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t MutexSlim<A>::tryLock() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        res = tryTake();
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        if(res == true)
+        {
+            probe_.acquire();
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t MutexSlim<A>::lock() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        if( !tryTake() )
+        {
+            ::LONGLONG const begin{ probe_.beginWait() };
+            ::AcquireSRWLockExclusive(&lock_);
+            probe_.endWait(begin);
+        }
+        probe_.acquire();
+        #else
+        ::AcquireSRWLockExclusive(&lock_);
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        res = true;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t MutexSlim<A>::lock(uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        res = tryTake();
+        if(res == false)
+        {
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            ::LONGLONG const begin{ probe_.beginWait() };
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            Timeout timeout( timeoutUs );
+            res = timedWaiter_.wait(*this, timeout);
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+            probe_.endWait(begin);
+            #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        }
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        if(res == true)
+        {
+            probe_.acquire();
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t MutexSlim<A>::isLockedRecursively() const noexcept
+{
+    // The mutex is not recursive
+    return false;
+}
+
+template <class A>
+bool_t MutexSlim<A>::unlock() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        probe_.release();
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        ::ReleaseSRWLockExclusive(&lock_);
+        timedWaiter_.notify();
+        res = true;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t MutexSlim<A>::tryTake() noexcept
+{
+    return ::TryAcquireSRWLockExclusive(&lock_) != 0;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_MUTEXSLIM_HPP_
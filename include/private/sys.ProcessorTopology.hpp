@@ -0,0 +1,207 @@
+/**
+ * @file      sys.ProcessorTopology.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_PROCESSORTOPOLOGY_HPP_
+#define SYS_PROCESSORTOPOLOGY_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Topology.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_PROCESSORS
+/**
+ * @brief Maximum number of logical processors and cores which are reported.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_PROCESSORS (256)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_PROCESSORS
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_NODES
+/**
+ * @brief Maximum number of processor packages and NUMA nodes which are reported.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_NODES (64)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_NODES
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_CACHES
+/**
+ * @brief Maximum number of processor caches which are reported.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_CACHES (512)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_CACHES
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ProcessorTopology.
+ * @brief Topology of processors of the system.
+ *
+ * The topology is queried once on construction, so all components see the same one.
+ * Processors, cores, packages, nodes and caches over the configured numbers are not reported.
+ */
+class ProcessorTopology : public NonCopyable<NoAllocator>, public Topology
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ProcessorTopology() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ProcessorTopology() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getNumberOfProcessors()
+     */
+    int32_t getNumberOfProcessors() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getNumberOfCores()
+     */
+    int32_t getNumberOfCores() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getNumberOfPackages()
+     */
+    int32_t getNumberOfPackages() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getNumberOfNodes()
+     */
+    int32_t getNumberOfNodes() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getNumberOfCaches()
+     */
+    int32_t getNumberOfCaches() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getProcessor(int32_t,Processor&)
+     */
+    bool_t getProcessor(int32_t index, Processor& processor) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getCache(int32_t,Cache&)
+     */
+    bool_t getCache(int32_t index, Cache& cache) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getCacheSize(int32_t)
+     */
+    size_t getCacheSize(int32_t level) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getCoreAffinity(int32_t,uint16_t&,uint64_t&)
+     */
+    bool_t getCoreAffinity(int32_t core, uint16_t& group, uint64_t& mask) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getPackageAffinity(int32_t,uint16_t&,uint64_t&)
+     */
+    bool_t getPackageAffinity(int32_t package, uint16_t& group, uint64_t& mask) const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Topology::getNodeAffinity(int32_t,uint16_t&,uint64_t&)
+     */
+    bool_t getNodeAffinity(int32_t node, uint16_t& group, uint64_t& mask) const noexcept override;
+
+private:
+
+    /**
+     * @struct Pool
+     * @brief Static memory of the topology.
+     */
+    struct Pool;
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Adds a record of the system to the topology.
+     *
+     * @param info The record.
+     */
+    void add(::SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& info) noexcept;
+
+    /**
+     * @brief Finds the set of processors a processor belongs to.
+     *
+     * @param sets      The sets.
+     * @param number    Number of the sets.
+     * @param processor The processor.
+     * @return Index of the set, or -1 if the processor belongs to no set.
+     */
+    static int32_t find(::GROUP_AFFINITY const* sets, int32_t number, Processor const& processor) noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    ProcessorTopology(ProcessorTopology const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    ProcessorTopology& operator=(ProcessorTopology const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    ProcessorTopology(ProcessorTopology&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    ProcessorTopology& operator=(ProcessorTopology&&) & noexcept = delete;
+
+    /**
+     * @brief Number of the logical processors.
+     */
+    int32_t numberOfProcessors_{ 0 };
+
+    /**
+     * @brief Number of the cores.
+     */
+    int32_t numberOfCores_{ 0 };
+
+    /**
+     * @brief Number of the packages.
+     */
+    int32_t numberOfPackages_{ 0 };
+
+    /**
+     * @brief Number of the NUMA nodes.
+     */
+    int32_t numberOfNodes_{ 0 };
+
+    /**
+     * @brief Number of the caches.
+     */
+    int32_t numberOfCaches_{ 0 };
+
+    /**
+     * @brief The static memory.
+     */
+    static Pool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_PROCESSORTOPOLOGY_HPP_
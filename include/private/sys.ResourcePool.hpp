@@ -0,0 +1,264 @@
+/**
+ * @file      sys.ResourcePool.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RESOURCEPOOL_HPP_
+#define SYS_RESOURCEPOOL_HPP_
+
+#include "sys.NonCopyable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ResourcePool.
+ * @brief Pool of memory slots for resources.
+ *
+ * The pool keeps N slots of S bytes in its own memory, and links free slots
+ * into a lock-free list. The list head is tagged by a counter of operations
+ * on it to avoid ABA problem, thus a slot is taken and returned by one
+ * successful compare-and-swap operation.
+ *
+ * @tparam S Size of one slot in bytes.
+ * @tparam N Number of slots.
+ */
+template <size_t S, int32_t N>
+class ResourcePool : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ResourcePool() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ResourcePool() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @brief Allocates a slot.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Address of the slot or a null pointer if no free slots or the size exceeds the slot size.
+     */
+    void* allocate(size_t size) noexcept;
+
+    /**
+     * @brief Frees a slot.
+     *
+     * @param ptr Address of the slot.
+     */
+    void free(void* ptr) noexcept;
+
+    /**
+     * @brief Tests if memory belongs to this pool.
+     *
+     * @param ptr Address of memory.
+     * @return True if the memory is a slot of this pool.
+     */
+    bool_t isOwned(void const* ptr) const noexcept;
+
+private:
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    ResourcePool(ResourcePool const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    ResourcePool& operator=(ResourcePool const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    ResourcePool(ResourcePool&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    ResourcePool& operator=(ResourcePool&&) & noexcept = delete;
+
+    /**
+     * @brief Size of one slot in bytes aligned to 16 bytes.
+     */
+    static const size_t SLOT_SIZE{ (S + 15U) & ~static_cast<size_t>(15U) };
+
+    /**
+     * @brief Mask of a slot number in the list head.
+     */
+    static const ::ULONG64 MASK_NUMBER{ 0x00000000FFFFFFFFULL };
+
+    /**
+     * @brief Memory of slots.
+     */
+    alignas(16) ucell_t memory_[SLOT_SIZE * static_cast<size_t>(N)];
+
+    /**
+     * @brief Numbers of next free slots starting from one, or zero for the last free slot.
+     */
+    volatile ::LONG next_[N];
+
+    /**
+     * @brief The list head of the first free slot number in low word and the tag in high word.
+     */
+    volatile ::LONG64 head_;
+
+};
+
+template <size_t S, int32_t N>
+ResourcePool<S,N>::ResourcePool() noexcept
+    : NonCopyable<NoAllocator>()
+    , memory_()
+    , next_()
+    , head_( 1 ) {
+    for(int32_t i{0}; i<N; i++)
+    {
+        next_[i] = (i < (N - 1)) ? (i + 2) : 0;
+    }
+}
+
+template <size_t S, int32_t N>
+bool_t ResourcePool<S,N>::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+template <size_t S, int32_t N>
+void* ResourcePool<S,N>::allocate(size_t size) noexcept
+{
+    void* addr{ NULLPTR };
+    if( isConstructed() && (size <= SLOT_SIZE) )
+    {
+        ::ULONG64 head{ static_cast< ::ULONG64 >(head_) };
+        while(true)
+        {
+            ::LONG const number{ static_cast< ::LONG >(head & MASK_NUMBER) };
+            if(number == 0)
+            {
+                break;
+            }
+            ::ULONG64 const tag{ (head >> 32) + 1U };
+            ::ULONG64 const next{ static_cast< ::ULONG64 >(next_[number - 1]) };
+            ::LONG64 const value{ static_cast< ::LONG64 >((tag << 32) | next) };
+            ::LONG64 const prev{ ::InterlockedCompareExchange64(&head_, value, static_cast< ::LONG64 >(head)) };
+            if(prev == static_cast< ::LONG64 >(head))
+            {
+                addr = &memory_[static_cast<size_t>(number - 1) * SLOT_SIZE];
+                break;
+            }
+            head = static_cast< ::ULONG64 >(prev);
+        }
+    }
+    return addr;
+}
+
+template <size_t S, int32_t N>
+void ResourcePool<S,N>::free(void* ptr) noexcept
+{
+    if( isOwned(ptr) )
+    {
+        ucell_t const* const slot{ static_cast<ucell_t const*>(ptr) }; ///< SCA AUTOSAR-C++14 Justified Rule M5-2-8
+        ::LONG const index{ static_cast< ::LONG >( static_cast<size_t>(slot - &memory_[0]) / SLOT_SIZE ) };
+        ::ULONG64 head{ static_cast< ::ULONG64 >(head_) };
+        while(true)
+        {
+            next_[index] = static_cast< ::LONG >(head & MASK_NUMBER);
+            ::ULONG64 const tag{ (head >> 32) + 1U };
+            ::ULONG64 const number{ static_cast< ::ULONG64 >(index + 1) };
+            ::LONG64 const value{ static_cast< ::LONG64 >((tag << 32) | number) };
+            ::LONG64 const prev{ ::InterlockedCompareExchange64(&head_, value, static_cast< ::LONG64 >(head)) };
+            if(prev == static_cast< ::LONG64 >(head))
+            {
+                break;
+            }
+            head = static_cast< ::ULONG64 >(prev);
+        }
+    }
+}
+
+template <size_t S, int32_t N>
+bool_t ResourcePool<S,N>::isOwned(void const* ptr) const noexcept
+{
+    bool_t res{ false };
+    if(ptr != NULLPTR)
+    {
+        ::ULONG_PTR const addr{ reinterpret_cast< ::ULONG_PTR >(ptr) };        ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        ::ULONG_PTR const begin{ reinterpret_cast< ::ULONG_PTR >(memory_) };   ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        res = (addr >= begin) && (addr < (begin + sizeof(memory_)));
+    }
+    return res;
+}
+
+/**
+ * @class ResourcePool<S,0>
+ * @brief Empty pool which has no slots.
+ *
+ * @tparam S Size of one slot in bytes.
+ */
+template <size_t S>
+class ResourcePool<S,0> : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ResourcePool() noexcept = default;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ResourcePool() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override
+    {
+        return Parent::isConstructed();
+    }
+
+    /**
+     * @copydoc eoos::sys::ResourcePool::allocate(size_t)
+     */
+    void* allocate(size_t) noexcept
+    {
+        return NULLPTR;
+    }
+
+    /**
+     * @copydoc eoos::sys::ResourcePool::free(void*)
+     */
+    void free(void*) noexcept
+    {
+    }
+
+    /**
+     * @copydoc eoos::sys::ResourcePool::isOwned(void const*)
+     */
+    bool_t isOwned(void const*) const noexcept
+    {
+        return false;
+    }
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RESOURCEPOOL_HPP_
@@ -0,0 +1,113 @@
+/**
+ * @file      sys.RwLockManager.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RWLOCKMANAGER_HPP_
+#define SYS_RWLOCKMANAGER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.RwLockFactory.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_RWLOCKS
+/**
+ * @brief Number of reader-writer locks which memory is statically allocated.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_RWLOCKS (256)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_RWLOCKS
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class RwLockManager.
+ * @brief Reader-writer lock sub-system manager.
+ */
+class RwLockManager : public NonCopyable<NoAllocator>, public RwLockFactory
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    RwLockManager() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~RwLockManager() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::RwLockFactory::create()
+     */
+    RwLock* create() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::RwLockFactory::create(bool_t)
+     */
+    RwLock* create(bool_t isWriterPreferred) noexcept override;
+
+    /**
+     * @brief Allocates memory for a reader-writer lock.
+     *
+     * The memory is taken from the static pool of reader-writer locks first, and from the heap if the pool is exhausted.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees memory of a reader-writer lock.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);
+
+private:
+    
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    RwLockManager(RwLockManager const&) noexcept = delete;
+    
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */       
+    RwLockManager& operator=(RwLockManager const&) noexcept = delete;   
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */       
+    RwLockManager(RwLockManager&&) noexcept = delete;
+    
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    RwLockManager& operator=(RwLockManager&&) & noexcept = delete;
+
+    /**
+     * @struct Pool
+     * @brief Static memory pools of the sub-system resources.
+     */
+    struct Pool;
+
+    /**
+     * @brief The static memory pools.
+     */
+    static Pool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RWLOCKMANAGER_HPP_
@@ -0,0 +1,244 @@
+/**
+ * @file      sys.RwLockSlim.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RWLOCKSLIM_HPP_
+#define SYS_RWLOCKSLIM_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.RwLock.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class RwLockSlim.
+ * @brief Reader-writer lock class.
+ *
+ * The lock is a Windows slim reader/writer lock. If writers are preferred, a writer
+ * takes a gate lock before it waits for the lock and passes the gate when it owns the lock,
+ * while readers pass the gate before they wait for the lock. Thus new readers wait
+ * at the gate while a writer is waiting for the lock.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class RwLockSlim : public NonCopyable<A>, public RwLock
+{
+    using Parent = NonCopyable<A>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param isWriterPreferred Prefer writers to readers.
+     */
+    explicit RwLockSlim(bool_t isWriterPreferred) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~RwLockSlim() noexcept override = default;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::RwLock::tryLockShared()
+     */
+    bool_t tryLockShared() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::RwLock::lockShared()
+     */
+    bool_t lockShared() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::RwLock::unlockShared()
+     */
+    bool_t unlockShared() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::RwLock::tryLock()
+     */
+    bool_t tryLock() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::RwLock::lock()
+     */
+    bool_t lock() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::RwLock::unlock()
+     */
+    bool_t unlock() noexcept override;
+
+private:
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    RwLockSlim(RwLockSlim const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    RwLockSlim& operator=(RwLockSlim const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    RwLockSlim(RwLockSlim&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    RwLockSlim& operator=(RwLockSlim&&) & noexcept = delete;
+
+    /**
+     * @brief Windows slim reader/writer lock object.
+     */
+    ::SRWLOCK lock_ = SRWLOCK_INIT;
+
+    /**
+     * @brief Gate of readers closed by waiting writers.
+     */
+    ::SRWLOCK gate_ = SRWLOCK_INIT;
+
+    /**
+     * @brief Prefer writers to readers.
+     */
+    bool_t const isWriterPreferred_;
+
+};
+
+template <class A>
+RwLockSlim<A>::RwLockSlim(bool_t isWriterPreferred) noexcept
+    : NonCopyable<A>()
+    , RwLock()
+    , isWriterPreferred_( isWriterPreferred ) {
+    setConstructed( true );
+}
+
+template <class A>
+bool_t RwLockSlim<A>::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t RwLockSlim<A>::tryLockShared() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        if(isWriterPreferred_)
+        {
+            if( ::TryAcquireSRWLockShared(&gate_) != 0 )
+            {
+                ::ReleaseSRWLockShared(&gate_);
+                res = ::TryAcquireSRWLockShared(&lock_) != 0;
+            }
+        }
+        else
+        {
+            res = ::TryAcquireSRWLockShared(&lock_) != 0;
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t RwLockSlim<A>::lockShared() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        if(isWriterPreferred_)
+        {
+            ::AcquireSRWLockShared(&gate_);
+            ::ReleaseSRWLockShared(&gate_);
+        }
+        ::AcquireSRWLockShared(&lock_);
+        res = true;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t RwLockSlim<A>::unlockShared() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::ReleaseSRWLockShared(&lock_);
+        res = true;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t RwLockSlim<A>::tryLock() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        res = ::TryAcquireSRWLockExclusive(&lock_) != 0;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t RwLockSlim<A>::lock() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        if(isWriterPreferred_)
+        {
+            ::AcquireSRWLockExclusive(&gate_);
+            ::AcquireSRWLockExclusive(&lock_);
+            ::ReleaseSRWLockExclusive(&gate_);
+        }
+        else
+        {
+            ::AcquireSRWLockExclusive(&lock_);
+        }
+        res = true;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t RwLockSlim<A>::unlock() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::ReleaseSRWLockExclusive(&lock_);
+        res = true;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RWLOCKSLIM_HPP_
@@ -8,6 +8,18 @@
 
 #include "sys.NonCopyable.hpp"
 #include "api.Scheduler.hpp"
+#include "sys.ThreadFactory.hpp"
+#include "sys.ProcessPriority.hpp"
+#include "sys.ThreadPool.hpp"
+#include "sys.ThreadCache.hpp"
+#include "sys.ProcessorTopology.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_THREADS
+/**
+ * @brief Number of threads which memory is statically allocated.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_THREADS (64)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_THREADS
 
 namespace eoos
 {
@@ -17,8 +29,13 @@ namespace sys
 /**
  * @class Scheduler
  * @brief Thread tasks scheduler class.
+ *
+ * The scheduler creates threads through the API interface and through the factory interface,
+ * and it executes short tasks on its pool of threads. Threads are run on system threads
+ * of the cache, which are reused for new threads when their tasks have returned. The priority
+ * class of the process is restored when the scheduler is destroyed.
  */
-class Scheduler : public NonCopyable<NoAllocator>, public api::Scheduler
+class Scheduler : public NonCopyable<NoAllocator>, public api::Scheduler, public ThreadFactory, public ProcessPriority
 {
     using Parent = NonCopyable<NoAllocator>;
 
@@ -32,7 +49,7 @@ public:
     /**
      * @brief Destructor.
      */
-    ~Scheduler() noexcept override = default;
+    ~Scheduler() noexcept override;
 
     /**
      * @copydoc eoos::api::Object::isConstructed()
@@ -42,7 +59,17 @@ public:
     /**
      * @copydoc eoos::api::Scheduler::createThread(api::Task&)
      */     
-    api::Thread* createThread(api::Task& task) noexcept override; ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+    AffineThread* createThread(api::Task& task) noexcept override; ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+
+    /**
+     * @copydoc eoos::sys::ThreadFactory::create(api::Task&)
+     */
+    AffineThread* create(api::Task& task) noexcept override; ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+
+    /**
+     * @copydoc eoos::sys::ThreadFactory::create(api::Task&,int32_t)
+     */
+    AffineThread* create(api::Task& task, int32_t node) noexcept override; ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
     
     /**
      * @copydoc eoos::api::Scheduler::sleep(int32_t)
@@ -54,6 +81,47 @@ public:
      */
     bool_t yield() noexcept override;
 
+    /**
+     * @copydoc eoos::sys::ProcessPriority::getPriorityClass()
+     */
+    int32_t getPriorityClass() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::ProcessPriority::setPriorityClass(int32_t)
+     */
+    bool_t setPriorityClass(int32_t priorityClass) noexcept override;
+
+    /**
+     * @brief Returns the topology of processors.
+     *
+     * @return The topology.
+     */
+    Topology& getTopology() noexcept;
+
+    /**
+     * @brief Returns the executor of short tasks.
+     *
+     * @return The executor.
+     */
+    Executor& getExecutor() noexcept;
+
+    /**
+     * @brief Allocates memory for a thread.
+     *
+     * The memory is taken from the static pool of threads first, and from the heap if the pool is exhausted.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees memory of a thread.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);
+
 private:
 
     /**
@@ -89,9 +157,41 @@ private:
     ::HANDLE processHandle_{ NULLPTR };
 
     /**
-     * @brief Priority of the root application process.
+     * @brief Priority of the root application process, which is restored on destruction.
      */    
     ::DWORD processPriority_{ 0U };
+
+    /**
+     * @brief Priority classes of the process indexed by the class constants.
+     */
+    static const ::DWORD PRIORITY_CLASSES[CLASS_REALTIME + 1];
+
+    /**
+     * @brief The topology of processors.
+     */
+    ProcessorTopology topology_{};
+
+    /**
+     * @brief The executor of short tasks.
+     */
+    ThreadPool executor_{ topology_ };
+
+    /**
+     * @brief The cache of system threads.
+     */
+    ThreadCache cache_{};
+
+    /**
+     * @struct Pool
+     * @brief Static memory pools of the sub-system resources.
+     */
+    struct Pool;
+
+    /**
+     * @brief The static memory pools.
+     */
+    static Pool pool_;
+
 };
 
 } // namespace sys
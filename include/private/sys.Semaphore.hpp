@@ -7,7 +7,9 @@
 #define SYS_SEMAPHORE_HPP_
 
 #include "sys.NonCopyable.hpp"
-#include "api.Semaphore.hpp"
+#include "sys.CountingSemaphore.hpp"
+#include "sys.LockProfiler.hpp"
+#include "sys.Timeout.hpp"
 
 namespace eoos
 {
@@ -17,11 +19,19 @@ namespace sys
 /**
  * @class Semaphore
  * @brief Semaphore class.
+ *
+ * A kernel semaphore cannot take many permits at once, so threads acquiring many permits
+ * take them one by one in turn, which prevents them from dividing the permits and
+ * waiting for each other forever. Thus, a batch of n permits costs n kernel calls,
+ * and SemaphoreLight suits acquiring many permits at once better.
+ *
+ * If the system is built with EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER, the semaphore reports
+ * its acquisitions, contentions and wait times to the lock profiler.
  * 
  * @tparam A Heap memory allocator class.
  */
 template <class A>
-class Semaphore : public NonCopyable<A>, public api::Semaphore
+class Semaphore : public NonCopyable<A>, public CountingSemaphore
 {
     using Parent = NonCopyable<A>;
 
@@ -54,8 +64,88 @@ public:
      */
     bool_t release() noexcept override;
 
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int32_t)
+     */
+    bool_t acquire(int32_t permits) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(uint64_t)
+     */
+    bool_t acquire(uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int32_t,uint64_t)
+     */
+    bool_t acquire(int32_t permits, uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::tryAcquire()
+     */
+    bool_t tryAcquire() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::tryAcquire(int32_t)
+     */
+    bool_t tryAcquire(int32_t permits) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::release(int32_t)
+     */
+    bool_t release(int32_t permits) noexcept override;
+
 private:
 
+    /**
+     * @copydoc eoos::sys::Waitable::getWaitHandle()
+     */
+    void* getWaitHandle() noexcept override;
+
+    /**
+     * @brief Waits for one permit.
+     *
+     * The acquisition is accounted by the caller, so a batch of permits counts once.
+     *
+     * @param timeout The timeout, or NULLPTR to wait infinitely.
+     * @return True if the permit has been acquired.
+     */
+    bool_t wait(Timeout* timeout) noexcept;
+
+    /**
+     * @brief Waits for a number of permits taking them one by one.
+     *
+     * Threads waiting for many permits take them in turn. The permits taken are given back
+     * if not all of them have been acquired.
+     *
+     * @param permits Number of permits.
+     * @param timeout The timeout, or NULLPTR to wait infinitely.
+     * @return True if all the permits have been acquired.
+     */
+    bool_t wait(int32_t permits, Timeout* timeout) noexcept;
+
+    /**
+     * @brief Takes a number of available permits without waiting.
+     *
+     * The permits taken are given back if not all of them are available.
+     *
+     * @param permits Number of permits.
+     * @return True if all the permits have been acquired.
+     */
+    bool_t take(int32_t permits) noexcept;
+
+    /**
+     * @brief Locks out other threads waiting for many permits.
+     *
+     * @param timeout The timeout, or NULLPTR to wait infinitely.
+     * @return True if the lock has been taken.
+     */
+    bool_t lockBatch(Timeout* timeout) noexcept;
+
+    /**
+     * @brief Unlocks threads waiting for many permits.
+     */
+    void unlockBatch() noexcept;
+
     /**
      * @brief Constructor.
      *
@@ -72,7 +162,7 @@ private:
      * @param permits The number of permits to release.
      * @return True if the semaphore is released.
      */
-    bool_t release(int32_t permits) const;	
+    bool_t releasePermits(int32_t permits) const;	
 
     /**
      * @copydoc eoos::Object::Object(Object const&)
@@ -104,12 +194,26 @@ private:
      */
     ::HANDLE handle_{ NULLPTR };
 
+    /**
+     * @brief Lock of threads acquiring many permits, which is one if it is taken.
+     */
+    volatile ::LONG batchLock_{ 0 };
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
+    /**
+     * @brief Contention counters of the semaphore.
+     */
+    LockProfiler::Probe probe_{ this, LockStatistics::Type::SEMAPHORE };
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
 };
 
 template <class A>
 Semaphore<A>::Semaphore(int32_t permits) noexcept 
     : NonCopyable<A>()
-    , api::Semaphore() {
+    , CountingSemaphore() {
     bool_t const isConstructed{ construct(permits) };
     setConstructed( isConstructed );
 }
@@ -136,8 +240,26 @@ bool_t Semaphore<A>::acquire() noexcept try
     bool_t res{ false };
     if( isConstructed() ) 
     {
-        ::DWORD error{ ::WaitForSingleObject(handle_, INFINITE) };
-        res = ( error == static_cast< ::DWORD >(WAIT_OBJECT_0) );
+        res = wait(1, NULLPTR);
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t Semaphore<A>::release() noexcept
+{
+    return release(1);
+}
+
+template <class A>
+bool_t Semaphore<A>::acquire(int32_t permits) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (permits > 0) )
+    {
+        res = wait(permits, NULLPTR);
     }
     return res;
 } catch (...) { ///< UT Justified Branch: OS dependency
@@ -145,18 +267,78 @@ bool_t Semaphore<A>::acquire() noexcept try
 }
 
 template <class A>
-bool_t Semaphore<A>::release() noexcept try
+bool_t Semaphore<A>::acquire(uint64_t timeoutUs) noexcept
+{
+    return acquire(1, timeoutUs);
+}
+
+template <class A>
+bool_t Semaphore<A>::acquire(int32_t permits, uint64_t timeoutUs) noexcept try
 {
     bool_t res{ false };
-    if( isConstructed() )
+    if( isConstructed() && (permits > 0) )
     {
-        res = release(1);
+        Timeout timeout( timeoutUs );
+        if( timeout.isConstructed() )
+        {
+            res = wait(permits, &timeout);
+        }
     }
     return res;
 } catch (...) { ///< UT Justified Branch: OS dependency
     return false;
 }
 
+template <class A>
+bool_t Semaphore<A>::tryAcquire() noexcept
+{
+    return tryAcquire(1);
+}
+
+template <class A>
+bool_t Semaphore<A>::tryAcquire(int32_t permits) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (permits > 0) )
+    {
+        if(permits == 1)
+        {
+            res = take(1);
+        }
+        else if( ::InterlockedCompareExchange(&batchLock_, 1, 0) == 0 )
+        {
+            res = take(permits);
+            unlockBatch();
+        }
+        else
+        {
+            // Another thread is acquiring many permits
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t Semaphore<A>::release(int32_t permits) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (permits > 0) )
+    {
+        res = releasePermits(permits);
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+void* Semaphore<A>::getWaitHandle() noexcept
+{
+    return isConstructed() ? handle_ : NULLPTR;
+}
+
 template <class A>
 bool_t Semaphore<A>::construct(int32_t permits) noexcept try
 {
@@ -191,7 +373,108 @@ bool_t Semaphore<A>::construct(int32_t permits) noexcept try
 }
 
 template <class A>
-bool_t Semaphore<A>::release(int32_t permits) const ///< SCA AUTOSAR-C++14 Justified Rule M9-3-3
+bool_t Semaphore<A>::wait(Timeout* const timeout) noexcept
+{
+    bool_t res{ false };
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    ::DWORD error{ ::WaitForSingleObject(handle_, 0U) };
+    if( error == static_cast< ::DWORD >(WAIT_TIMEOUT) )
+    {
+        ::LONGLONG const begin{ probe_.beginWait() };
+        error = (timeout != NULLPTR) ? timeout->wait(handle_) : ::WaitForSingleObject(handle_, INFINITE);
+        probe_.endWait(begin);
+    }
+    res = ( error == static_cast< ::DWORD >(WAIT_OBJECT_0) );
+    #else
+    ::DWORD const error{ (timeout != NULLPTR) ? timeout->wait(handle_) : ::WaitForSingleObject(handle_, INFINITE) };
+    res = ( error == static_cast< ::DWORD >(WAIT_OBJECT_0) );
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    return res;
+}
+
+template <class A>
+bool_t Semaphore<A>::wait(int32_t const permits, Timeout* const timeout) noexcept
+{
+    bool_t res{ false };
+    bool_t const isBatch{ permits > 1 };
+    if( (!isBatch) || lockBatch(timeout) )
+    {
+        int32_t taken{ 0 };
+        while( (taken < permits) && wait(timeout) )
+        {
+            taken++;
+        }
+        res = taken == permits;
+        if( (res == false) && (taken > 0) )
+        {
+            static_cast<void>( releasePermits(taken) );
+        }
+        if(isBatch)
+        {
+            unlockBatch();
+        }
+    }
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    if(res == true)
+    {
+        probe_.take();
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    return res;
+}
+
+template <class A>
+bool_t Semaphore<A>::take(int32_t const permits) noexcept
+{
+    int32_t taken{ 0 };
+    while( (taken < permits) && (::WaitForSingleObject(handle_, 0U) == static_cast< ::DWORD >(WAIT_OBJECT_0)) )
+    {
+        taken++;
+    }
+    bool_t const res{ taken == permits };
+    if( (res == false) && (taken > 0) )
+    {
+        // Give back the permits taken as not all of them are available
+        static_cast<void>( releasePermits(taken) );
+    }
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    if(res == true)
+    {
+        probe_.take();
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    return res;
+}
+
+template <class A>
+bool_t Semaphore<A>::lockBatch(Timeout* const timeout) noexcept
+{
+    bool_t res{ ::InterlockedCompareExchange(&batchLock_, 1, 0) == 0 };
+    bool_t isExpired{ false };
+    while( (!res) && (!isExpired) )
+    {
+        ::DWORD const ms{ (timeout != NULLPTR) ? timeout->getMilliseconds() : INFINITE };
+        isExpired = ms == 0U;
+        if(!isExpired)
+        {
+            // Sleep while the lock is taken, the wait returns at once if it has been released
+            ::LONG locked{ 1 };
+            static_cast<void>( ::WaitOnAddress(&batchLock_, &locked, sizeof(locked), ms) );
+            res = ::InterlockedCompareExchange(&batchLock_, 1, 0) == 0;
+        }
+    }
+    return res;
+}
+
+template <class A>
+void Semaphore<A>::unlockBatch() noexcept
+{
+    static_cast<void>( ::InterlockedExchange(&batchLock_, 0) );
+    ::WakeByAddressSingle( const_cast< ::LONG* >(&batchLock_) ); ///< SCA AUTOSAR-C++14 Justified Rule A5-2-3
+}
+
+template <class A>
+bool_t Semaphore<A>::releasePermits(int32_t permits) const ///< SCA AUTOSAR-C++14 Justified Rule M9-3-3
 {
     ::LONG const lReleaseCount{ static_cast< ::LONG >(permits) };
     ::BOOL res{ ::ReleaseSemaphore(handle_, lReleaseCount, NULL) };
@@ -0,0 +1,537 @@
+/**
+ * @file      sys.SemaphoreLight.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SEMAPHORELIGHT_HPP_
+#define SYS_SEMAPHORELIGHT_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.CountingSemaphore.hpp"
+#include "sys.Timeout.hpp"
+#include "sys.LockProfiler.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class SemaphoreLight
+ * @brief Lightweight semaphore class.
+ *
+ * The semaphore keeps its count in an atomic word, which is the number of available permits
+ * if it is positive, or the number of waiting threads if it is negative. Thus acquiring
+ * an available permit and releasing a permit no thread waits for are done in user space,
+ * and the kernel semaphore is used only to block and wake up waiting threads.
+ * The kernel semaphore is created when a thread blocks the first time.
+ *
+ * A thread acquiring many permits takes the available ones and waits on the kernel
+ * semaphore only for the deficit, and a thread releasing many permits wakes up all
+ * the threads it can satisfy with one kernel call. Threads waiting for many permits
+ * are serialized, so they do not hold parts of their permits waiting for each other.
+ * A thread whose timeout expires stops waiting for the permits not released yet
+ * and gives back the permits it has taken.
+ * The semaphore cannot be waited for together with other objects.
+ *
+ * If the system is built with EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER, the semaphore reports
+ * its acquisitions, contentions and wait times to the lock profiler. A contention is
+ * an acquisition which has not taken the permits by spinning.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class SemaphoreLight : public NonCopyable<A>, public CountingSemaphore
+{
+    using Parent = NonCopyable<A>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param permits   The initial number of permits available.
+     * @param spinCount Number of spins waiting for a permit before blocking.
+     */
+    SemaphoreLight(int32_t permits, uint32_t spinCount) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~SemaphoreLight() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::api::Semaphore::acquire()
+     */
+    bool_t acquire() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Semaphore::release()
+     */
+    bool_t release() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int32_t)
+     */
+    bool_t acquire(int32_t permits) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(uint64_t)
+     */
+    bool_t acquire(uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::acquire(int32_t,uint64_t)
+     */
+    bool_t acquire(int32_t permits, uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::tryAcquire()
+     */
+    bool_t tryAcquire() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::tryAcquire(int32_t)
+     */
+    bool_t tryAcquire(int32_t permits) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::CountingSemaphore::release(int32_t)
+     */
+    bool_t release(int32_t permits) noexcept override;
+
+private:
+
+    /**
+     * @copydoc eoos::sys::Waitable::getWaitHandle()
+     */
+    void* getWaitHandle() noexcept override;
+
+    /**
+     * @brief Tries to take available permits in user space.
+     *
+     * @param permits Number of permits to take.
+     * @return True if all the permits have been taken.
+     */
+    bool_t tryTake(int32_t permits) noexcept;
+
+    /**
+     * @brief Acquires a number of permits.
+     *
+     * @param permits Number of permits.
+     * @param timeout The timeout, or NULLPTR to wait infinitely.
+     * @return True if all the permits have been acquired.
+     */
+    bool_t wait(int32_t permits, Timeout* timeout) noexcept;
+
+    /**
+     * @brief Locks out other threads waiting for many permits.
+     *
+     * @param timeout The timeout, or NULLPTR to wait infinitely.
+     * @return True if the lock has been taken.
+     */
+    bool_t lockBatch(Timeout* timeout) noexcept;
+
+    /**
+     * @brief Unlocks threads waiting for many permits.
+     */
+    void unlockBatch() noexcept;
+
+    /**
+     * @brief Stops waiting for one permit which has not been released yet.
+     *
+     * @return True if the thread has stopped waiting, or false if a releasing thread
+     *         has counted the permit and is going to wake the thread up.
+     */
+    bool_t withdraw() noexcept;
+
+    /**
+     * @brief Returns the kernel semaphore creating it if it does not exist.
+     *
+     * @return The kernel semaphore handle or a null pointer.
+     */
+    ::HANDLE getHandle() noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    SemaphoreLight(SemaphoreLight const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    SemaphoreLight& operator=(SemaphoreLight const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    SemaphoreLight(SemaphoreLight&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    SemaphoreLight& operator=(SemaphoreLight&&) & noexcept = delete;
+
+    /**
+     * @brief Maximum count of the kernel semaphore.
+     */
+    static const ::LONG MAXIMUM_COUNT{ 0x7FFFFFFF };
+
+    /**
+     * @brief Number of available permits, or negated number of waiting threads.
+     */
+    volatile ::LONG count_;
+
+    /**
+     * @brief Number of spins waiting for a permit before blocking.
+     */
+    uint32_t const spinCount_;
+
+    /**
+     * @brief The kernel semaphore waiting threads block on.
+     */
+    ::PVOID volatile handle_{ NULLPTR };
+
+    /**
+     * @brief Lock of threads waiting for many permits, which is one if it is taken.
+     */
+    volatile ::LONG batchLock_{ 0 };
+
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
+    /**
+     * @brief Contention counters of the semaphore.
+     */
+    LockProfiler::Probe probe_{ this, LockStatistics::Type::SEMAPHORE };
+
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+
+};
+
+template <class A>
+SemaphoreLight<A>::SemaphoreLight(int32_t permits, uint32_t spinCount) noexcept
+    : NonCopyable<A>()
+    , CountingSemaphore()
+    , count_( static_cast< ::LONG >(permits) )
+    , spinCount_( spinCount ) {
+    bool_t const isConstructed{ permits >= 0 };
+    setConstructed( isConstructed );
+}
+
+template <class A>
+SemaphoreLight<A>::~SemaphoreLight() noexcept
+{
+    if(handle_ != NULLPTR)
+    {
+        static_cast<void>( ::CloseHandle(handle_) );
+        handle_ = NULLPTR;
+    }
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::acquire() noexcept
+{
+    return acquire(1);
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::release() noexcept
+{
+    return release(1);
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::acquire(int32_t permits) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (permits > 0) )
+    {
+        res = wait(permits, NULLPTR);
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::acquire(uint64_t timeoutUs) noexcept
+{
+    return acquire(1, timeoutUs);
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::acquire(int32_t permits, uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (permits > 0) )
+    {
+        Timeout timeout( timeoutUs );
+        if( timeout.isConstructed() )
+        {
+            res = wait(permits, &timeout);
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::tryAcquire() noexcept
+{
+    return tryAcquire(1);
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::tryAcquire(int32_t permits) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (permits > 0) )
+    {
+        res = tryTake(permits);
+        #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+        if(res == true)
+        {
+            probe_.take();
+        }
+        #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::release(int32_t permits) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (permits > 0) )
+    {
+        ::LONG const count{ ::InterlockedExchangeAdd(&count_, permits) };
+        if(count >= 0)
+        {
+            res = true;
+        }
+        else
+        {
+            // Threads are waiting or going to wait, so wake up as many as the permits satisfy
+            ::LONG const waiters{ -count };
+            ::LONG const wakeups{ (waiters < permits) ? waiters : permits };
+            ::HANDLE const handle{ getHandle() };
+            if(handle != NULLPTR)
+            {
+                res = ::ReleaseSemaphore(handle, wakeups, NULL) != 0;
+            }
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+void* SemaphoreLight<A>::getWaitHandle() noexcept
+{
+    // The permits are counted in user space, thus the kernel semaphore does not fire on releases
+    return NULLPTR;
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::tryTake(int32_t permits) noexcept
+{
+    bool_t res{ false };
+    ::LONG count{ count_ };
+    while(count >= permits)
+    {
+        ::LONG const prev{ ::InterlockedCompareExchange(&count_, count - permits, count) };
+        if(prev == count)
+        {
+            res = true;
+            break;
+        }
+        count = prev;
+    }
+    return res;
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::wait(int32_t const permits, Timeout* const timeout) noexcept
+{
+    bool_t res{ false };
+    for(uint32_t i{0U}; i<spinCount_; i++)
+    {
+        res = tryTake(permits);
+        if(res == true)
+        {
+            break;
+        }
+        ::YieldProcessor();
+    }
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    bool_t const isContended{ res == false };
+    ::LONGLONG const begin{ isContended ? probe_.beginWait() : 0 };
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    bool_t const isBatch{ permits > 1 };
+    if( (res == false) && ( (!isBatch) || lockBatch(timeout) ) )
+    {
+        ::LONG const count{ ::InterlockedExchangeAdd(&count_, -permits) };
+        // Each permit which was not available is a waiting on the kernel semaphore
+        ::LONG deficit{ permits };
+        if(count >= permits)
+        {
+            deficit = 0;
+        }
+        else if(count > 0)
+        {
+            deficit = permits - count;
+        }
+        else
+        {
+            // All the permits are waited for
+        }
+        if(deficit == 0)
+        {
+            res = true;
+        }
+        else
+        {
+            // Not all permits available, so wait for releasing threads to wake this one up
+            ::HANDLE const handle{ getHandle() };
+            if(handle != NULLPTR)
+            {
+                ::LONG woken{ 0 };
+                while(woken < deficit)
+                {
+                    ::DWORD const error{ (timeout != NULLPTR) ? timeout->wait(handle) : ::WaitForSingleObject(handle, INFINITE) };
+                    if( error != static_cast< ::DWORD >(WAIT_OBJECT_0) )
+                    {
+                        break;
+                    }
+                    woken++;
+                }
+                res = woken == deficit;
+                if(res == false)
+                {
+                    ::LONG taken{ (permits - deficit) + woken };
+                    for(::LONG j{woken}; j<deficit; j++)
+                    {
+                        if( !withdraw() )
+                        {
+                            // The permit has been released for this thread, so take it to give back
+                            static_cast<void>( ::WaitForSingleObject(handle, INFINITE) );
+                            taken++;
+                        }
+                    }
+                    if(taken > 0)
+                    {
+                        static_cast<void>( release(taken) );
+                    }
+                }
+            }
+            else
+            {   ///< UT Justified Branch: OS dependency
+                static_cast<void>( ::InterlockedExchangeAdd(&count_, permits) );
+            }
+        }
+        if(isBatch)
+        {
+            unlockBatch();
+        }
+    }
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    if(isContended)
+    {
+        probe_.endWait(begin);
+    }
+    if(res == true)
+    {
+        probe_.take();
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    return res;
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::lockBatch(Timeout* const timeout) noexcept
+{
+    bool_t res{ ::InterlockedCompareExchange(&batchLock_, 1, 0) == 0 };
+    bool_t isExpired{ false };
+    while( (!res) && (!isExpired) )
+    {
+        ::DWORD const ms{ (timeout != NULLPTR) ? timeout->getMilliseconds() : INFINITE };
+        isExpired = ms == 0U;
+        if(!isExpired)
+        {
+            // Sleep while the lock is taken, the wait returns at once if it has been released
+            ::LONG locked{ 1 };
+            static_cast<void>( ::WaitOnAddress(&batchLock_, &locked, sizeof(locked), ms) );
+            res = ::InterlockedCompareExchange(&batchLock_, 1, 0) == 0;
+        }
+    }
+    return res;
+}
+
+template <class A>
+void SemaphoreLight<A>::unlockBatch() noexcept
+{
+    static_cast<void>( ::InterlockedExchange(&batchLock_, 0) );
+    ::WakeByAddressSingle( const_cast< ::LONG* >(&batchLock_) ); ///< SCA AUTOSAR-C++14 Justified Rule A5-2-3
+}
+
+template <class A>
+bool_t SemaphoreLight<A>::withdraw() noexcept
+{
+    bool_t res{ false };
+    ::LONG count{ count_ };
+    while(count < 0)
+    {
+        ::LONG const prev{ ::InterlockedCompareExchange(&count_, count + 1, count) };
+        if(prev == count)
+        {
+            res = true;
+            break;
+        }
+        count = prev;
+    }
+    return res;
+}
+
+template <class A>
+::HANDLE SemaphoreLight<A>::getHandle() noexcept
+{
+    ::HANDLE handle{ handle_ };
+    if(handle == NULLPTR)
+    {
+        ::HANDLE const created{ ::CreateSemaphore(NULL, 0, MAXIMUM_COUNT, NULL) };
+        if(created != NULLPTR)
+        {
+            // Another thread might have created the semaphore concurrently
+            ::PVOID const prev{ ::InterlockedCompareExchangePointer(&handle_, created, NULLPTR) };
+            if(prev == NULLPTR)
+            {
+                handle = created;
+            }
+            else
+            {
+                static_cast<void>( ::CloseHandle(created) );
+                handle = prev;
+            }
+        }
+    }
+    return handle;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SEMAPHORELIGHT_HPP_
@@ -8,6 +8,14 @@
 
 #include "sys.NonCopyable.hpp"
 #include "api.SemaphoreManager.hpp"
+#include "sys.SemaphoreFactory.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES
+/**
+ * @brief Number of semaphores which memory is statically allocated.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES (256)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES
 
 namespace eoos
 {
@@ -17,8 +25,11 @@ namespace sys
 /**
  * @class SemaphoreManager.
  * @brief Semaphore sub-system manager.
+ *
+ * The manager creates semaphores of the default type through the API interface,
+ * and semaphores of other types through the factory interface.
  */
-class SemaphoreManager : public NonCopyable<NoAllocator>, public api::SemaphoreManager
+class SemaphoreManager : public NonCopyable<NoAllocator>, public api::SemaphoreManager, public SemaphoreFactory
 {
     using Parent = NonCopyable<NoAllocator>;
 
@@ -42,7 +53,34 @@ public:
     /**
      * @copydoc eoos::api::SemaphoreManager::create()
      */
-    api::Semaphore* create(int32_t permits) noexcept override;
+    CountingSemaphore* create(int32_t permits) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::SemaphoreFactory::create(int32_t, Type)
+     */
+    CountingSemaphore* create(int32_t permits, Type type) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::SemaphoreFactory::create(int32_t, Type, uint32_t)
+     */
+    CountingSemaphore* create(int32_t permits, Type type, uint32_t spinCount) noexcept override;
+
+    /**
+     * @brief Allocates memory for a semaphore.
+     *
+     * The memory is taken from the static pool of semaphores first, and from the heap if the pool is exhausted.
+     *
+     * @param size Number of bytes to allocate.
+     * @return Allocated memory address or a null pointer.
+     */
+    static void* allocate(size_t size);
+
+    /**
+     * @brief Frees memory of a semaphore.
+     *
+     * @param ptr Address of allocated memory block or a null pointer.
+     */
+    static void free(void* ptr);
 
 private:
     
@@ -64,7 +102,18 @@ private:
     /**
      * @copydoc eoos::Object::operator=(Object&&)
      */
-    SemaphoreManager& operator=(SemaphoreManager&&) & noexcept = delete;        
+    SemaphoreManager& operator=(SemaphoreManager&&) & noexcept = delete;
+
+    /**
+     * @struct Pool
+     * @brief Static memory pools of the sub-system resources.
+     */
+    struct Pool;
+
+    /**
+     * @brief The static memory pools.
+     */
+    static Pool pool_;
 
 };
 
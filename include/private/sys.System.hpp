@@ -10,9 +10,14 @@
 #include "api.System.hpp"
 #include "sys.Scheduler.hpp"
 #include "sys.MutexManager.hpp"
+#include "sys.RwLockManager.hpp"
 #include "sys.SemaphoreManager.hpp"
+#include "sys.ConditionManager.hpp"
+#include "sys.MultiWaiter.hpp"
 #include "sys.StreamManager.hpp"
 #include "sys.Heap.hpp"
+#include "sys.HeapReplayer.hpp"
+#include "sys.LockProfiler.hpp"
 #include "sys.Error.hpp"
 
 namespace eoos
@@ -48,28 +53,77 @@ public:
     /**
      * @copydoc eoos::api::System::getHeap()
      */
-    api::Heap& getHeap() noexcept override;
+    Heap& getHeap() noexcept override;
 
     /**
      * @copydoc eoos::api::System::getScheduler()
      */
-    api::Scheduler& getScheduler() noexcept override;    
+    Scheduler& getScheduler() noexcept override;    
     
     /**
      * @copydoc eoos::api::System::getMutexManager()
      */
-    api::MutexManager& getMutexManager() noexcept override;
+    MutexManager& getMutexManager() noexcept override;
 
     /**
      * @copydoc eoos::api::System::getSemaphoreManager()
      */
-    api::SemaphoreManager& getSemaphoreManager() noexcept override;
+    SemaphoreManager& getSemaphoreManager() noexcept override;
     
     /**
      * @copydoc eoos::api::System::getStreamManager()
      */
     api::StreamManager& getStreamManager() noexcept override;
 
+    /**
+     * @brief Returns the reader-writer lock sub-system manager.
+     *
+     * @return The reader-writer lock sub-system manager.
+     */
+    RwLockManager& getRwLockManager() noexcept;
+
+    /**
+     * @brief Returns the condition variable and event sub-system manager.
+     *
+     * @return The condition variable and event sub-system manager.
+     */
+    ConditionManager& getConditionManager() noexcept;
+
+    /**
+     * @brief Returns the waiter for many objects at once.
+     *
+     * @return The waiter for many objects.
+     */
+    MultiWaiter& getMultiWaiter() noexcept;
+
+    /**
+     * @brief Returns the heap statistics.
+     *
+     * @return The heap statistics.
+     */
+    HeapStatistics& getHeapStatistics() noexcept;
+
+    /**
+     * @brief Returns the heap allocation trace.
+     *
+     * @return The heap allocation trace.
+     */
+    HeapTrace& getHeapTrace() noexcept;
+
+    /**
+     * @brief Returns the heap allocation trace replay.
+     *
+     * @return The heap allocation trace replay.
+     */
+    HeapBenchmark& getHeapBenchmark() noexcept;
+
+    /**
+     * @brief Returns the lock contention statistics.
+     *
+     * @return The lock contention statistics.
+     */
+    LockStatistics& getLockStatistics() noexcept;
+
     /**
      * @brief Executes the operating system.
      *
@@ -84,7 +138,7 @@ public:
      *
      * @return The EOOS system instance.
      */
-    static api::System& getSystem() noexcept;
+    static System& getSystem() noexcept;
 
 private:
 
@@ -118,13 +172,23 @@ private:
     /**
      * @brief The operating system.
      */
-    static api::System* eoos_;
+    static System* eoos_;
 
     /**
      * @brief The system heap.
      */
     Heap heap_{};    
 
+    /**
+     * @brief The heap allocation trace replay.
+     */
+    HeapReplayer heapReplayer_{};
+
+    /**
+     * @brief The lock contention profiler.
+     */
+    LockProfiler lockProfiler_{};
+
     /**
      * @brief The operating system scheduler.
      */
@@ -135,10 +199,25 @@ private:
      */
     MutexManager mutexManager_{};
 
+    /**
+     * @brief The reader-writer lock sub-system manager.
+     */
+    RwLockManager rwLockManager_{};
+
     /**
      * @brief The semaphore sub-system manager.
      */
     SemaphoreManager semaphoreManager_{};
+
+    /**
+     * @brief The condition variable and event sub-system manager.
+     */
+    ConditionManager conditionManager_{};
+
+    /**
+     * @brief The waiter for many objects at once.
+     */
+    MultiWaiter multiWaiter_{};
     
     /**
      * @brief The stream sub-system manager.
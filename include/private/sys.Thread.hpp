@@ -7,8 +7,11 @@
 #define SYS_THREAD_HPP_
 
 #include "sys.NonCopyable.hpp"
-#include "api.Thread.hpp"
+#include "sys.AffineThread.hpp"
 #include "api.Task.hpp"
+#include "sys.Timeout.hpp"
+#include "sys.ThreadPriority.hpp"
+#include "sys.ThreadAffinity.hpp"
 
 namespace eoos
 {
@@ -22,7 +25,7 @@ namespace sys
  * @tparam A Heap memory allocator class.
  */
 template <class A>
-class Thread : public NonCopyable<A>, public api::Thread
+class Thread : public NonCopyable<A>, public AffineThread
 {
     using Parent = NonCopyable<A>;
 
@@ -55,6 +58,11 @@ public:
      */
     bool_t join() noexcept override;
 
+    /**
+     * @copydoc eoos::sys::TimedThread::join(uint64_t)
+     */
+    bool_t join(uint64_t timeoutUs) noexcept override;
+
     /**
      * @copydoc eoos::api::Thread::getPriority()
      */
@@ -65,8 +73,33 @@ public:
      */
     bool_t setPriority(int32_t priority) noexcept override;
 
+    /**
+     * @copydoc eoos::sys::AffineThread::setAffinity(uint16_t,uint64_t)
+     */
+    bool_t setAffinity(uint16_t group, uint64_t mask) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::AffineThread::setIdealProcessor(uint32_t)
+     */
+    bool_t setIdealProcessor(uint32_t number) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::AffineThread::setNode(int32_t)
+     */
+    bool_t setNode(int32_t node) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::AffineThread::getNode()
+     */
+    int32_t getNode() const noexcept override;
+
 private:
 
+    /**
+     * @copydoc eoos::sys::Waitable::getWaitHandle()
+     */
+    void* getWaitHandle() noexcept override;
+
     /**
      * @brief Constructor.
      *
@@ -129,6 +162,11 @@ private:
      */    
     int32_t priority_;
 
+    /**
+     * @brief Placement of this thread on processors.
+     */
+    ThreadAffinity affinity_;
+
     /**
      * @brief Current identifier.
      */
@@ -144,10 +182,11 @@ private:
 template <class A>
 Thread<A>::Thread(api::Task& task) noexcept ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
     : NonCopyable<A>()
-    , api::Thread()
+    , AffineThread()
     , task_(&task)       
     , status_(STATUS_NEW)
     , priority_(PRIORITY_NORM)    
+    , affinity_()
     , id_(0U)
     , handle_(NULLPTR) {
     bool_t const isConstructed{ construct() };
@@ -208,6 +247,29 @@ bool_t Thread<A>::join() noexcept try
     return false;
 }
 
+template <class A>
+bool_t Thread<A>::join(uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (status_ == STATUS_RUNNABLE) )
+    {
+        Timeout timeout( timeoutUs );
+        if( timeout.isConstructed() )
+        {
+            ::DWORD const error{ timeout.wait(handle_) };
+            // The thread stays joinable if it has not terminated
+            if( error != static_cast< ::DWORD >(WAIT_TIMEOUT) )
+            {
+                res = (error == 0U) ? true : false;
+                status_ = STATUS_DEAD;
+            }
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
 template <class A>
 int32_t Thread<A>::getPriority() const noexcept
 {
@@ -218,27 +280,67 @@ template <class A>
 bool_t Thread<A>::setPriority(int32_t priority) noexcept
 {
     bool_t res{ false };
-    if( isConstructed() )
+    if( isConstructed() && ThreadPriority::isValid(priority) )
     {
-        if( (PRIORITY_MIN <= priority) && (priority <= PRIORITY_MAX) )
-        {
-            priority_ = priority;
-            res = true;
-        }
-        else if (priority == PRIORITY_IDLE)
+        // The system thread exists since construction, so a priority is applied until the thread is joined
+        if( (status_ == STATUS_DEAD) || ThreadPriority::apply(handle_, priority) )
         {
             priority_ = priority;
             res = true;
         }
-        else 
-        {
-            res = false;
-        }
     }
-    // @todo Implemet setting priority on system level regarding common API rage
     return res;
 }
 
+template <class A>
+bool_t Thread<A>::setAffinity(uint16_t group, uint64_t mask) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        // The system thread exists since construction, so a placement is applied until the thread is joined
+        ::HANDLE const handle{ (status_ != STATUS_DEAD) ? handle_ : NULLPTR };
+        res = affinity_.setAffinity(group, mask, handle);
+    }
+    return res;
+}
+
+template <class A>
+bool_t Thread<A>::setIdealProcessor(uint32_t number) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::HANDLE const handle{ (status_ != STATUS_DEAD) ? handle_ : NULLPTR };
+        res = affinity_.setIdealProcessor(number, handle);
+    }
+    return res;
+}
+
+template <class A>
+bool_t Thread<A>::setNode(int32_t node) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::HANDLE const handle{ (status_ != STATUS_DEAD) ? handle_ : NULLPTR };
+        res = affinity_.setNode(node, handle);
+    }
+    return res;
+}
+
+template <class A>
+int32_t Thread<A>::getNode() const noexcept
+{
+    return affinity_.getNode();
+}
+
+template <class A>
+void* Thread<A>::getWaitHandle() noexcept
+{
+    return isConstructed() ? handle_ : NULLPTR;
+}
+
 template <class A>
 bool_t Thread<A>::construct() noexcept try
 {  
@@ -0,0 +1,149 @@
+/**
+ * @file      sys.ThreadAffinity.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADAFFINITY_HPP_
+#define SYS_THREADAFFINITY_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.AffineThread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadAffinity
+ * @brief Placement of a system thread on processors.
+ *
+ * The placement is kept to be applied to a system thread which is taken later, and
+ * it is applied at once if a system thread is given.
+ */
+class ThreadAffinity : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    ThreadAffinity() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ThreadAffinity() noexcept override = default;
+
+    /**
+     * @brief Restricts a thread to processors of a processor group.
+     *
+     * @param group  Index of the processor group.
+     * @param mask   Mask of the processors in the group.
+     * @param handle The system thread, or NULLPTR to keep the placement only.
+     * @return True if the placement has been set.
+     */
+    bool_t setAffinity(uint16_t group, uint64_t mask, ::HANDLE handle) noexcept;
+
+    /**
+     * @brief Sets the processor preferred for a thread.
+     *
+     * @param number Number of the processor in the group of the thread.
+     * @param handle The system thread, or NULLPTR to keep the placement only.
+     * @return True if the placement has been set.
+     */
+    bool_t setIdealProcessor(uint32_t number, ::HANDLE handle) noexcept;
+
+    /**
+     * @brief Restricts a thread to processors of a NUMA node.
+     *
+     * @param node   Number of the node, or NODE_ANY.
+     * @param handle The system thread, or NULLPTR to keep the placement only.
+     * @return True if the placement has been set.
+     */
+    bool_t setNode(int32_t node, ::HANDLE handle) noexcept;
+
+    /**
+     * @brief Returns the NUMA node.
+     *
+     * @return Number of the node, or NODE_ANY.
+     */
+    int32_t getNode() const noexcept;
+
+    /**
+     * @brief Applies the placement to a system thread.
+     *
+     * A thread which is not restricted is allowed to run on processors of the process,
+     * as the system thread may keep a placement of a previous task.
+     *
+     * @param handle The system thread.
+     * @return True if the placement has been applied.
+     */
+    bool_t apply(::HANDLE handle) const noexcept;
+
+private:
+
+    /**
+     * @brief Sets the processor group affinity of a system thread.
+     *
+     * @param affinity The affinity.
+     * @param handle   The system thread, or NULLPTR.
+     * @return True if the affinity has been set.
+     */
+    static bool_t setGroupAffinity(::GROUP_AFFINITY const& affinity, ::HANDLE handle) noexcept;
+
+    /**
+     * @brief Allows a system thread to run on processors of the process.
+     *
+     * @param handle The system thread, or NULLPTR.
+     * @return True if the affinity has been set.
+     */
+    static bool_t resetAffinity(::HANDLE handle) noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    ThreadAffinity(ThreadAffinity const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    ThreadAffinity& operator=(ThreadAffinity const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    ThreadAffinity(ThreadAffinity&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    ThreadAffinity& operator=(ThreadAffinity&&) & noexcept = delete;
+
+    /**
+     * @brief The ideal processor is not set.
+     */
+    static const ::DWORD IDEAL_ANY{ 0xFFFFFFFFU };
+
+    /**
+     * @brief The processor group affinity, which mask is zero if the thread is not restricted.
+     */
+    ::GROUP_AFFINITY affinity_{};
+
+    /**
+     * @brief The ideal processor.
+     */
+    ::DWORD ideal_{ IDEAL_ANY };
+
+    /**
+     * @brief The NUMA node.
+     */
+    int32_t node_{ AffineThread::NODE_ANY };
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADAFFINITY_HPP_
@@ -0,0 +1,277 @@
+/**
+ * @file      sys.ThreadCache.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADCACHE_HPP_
+#define SYS_THREADCACHE_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "api.Task.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_THREAD_CACHE_SIZE
+/**
+ * @brief Maximum number of finished threads which park to be reused, or zero to disable the cache.
+ */
+#define EOOS_GLOBAL_SYS_THREAD_CACHE_SIZE (16)
+#endif // EOOS_GLOBAL_SYS_THREAD_CACHE_SIZE
+
+#ifndef EOOS_GLOBAL_SYS_THREAD_CACHE_TIMEOUT
+/**
+ * @brief Time in milliseconds a parked thread waits for a new task before it exits.
+ */
+#define EOOS_GLOBAL_SYS_THREAD_CACHE_TIMEOUT (30000)
+#endif // EOOS_GLOBAL_SYS_THREAD_CACHE_TIMEOUT
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_CARRIERS
+/**
+ * @brief Maximum number of system threads which can be reused, either running or parked.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_CARRIERS (64)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_CARRIERS
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadCache.
+ * @brief Cache of system threads which are reused for new tasks.
+ *
+ * A system thread of the cache, which is called a carrier, runs tasks one by one. A carrier
+ * is held by a thread object and by its running task, and when both have released it, it parks
+ * waiting for a new task if the number of parked carriers is less than the cache size, or it exits.
+ * A parked carrier exits if it has not been taken for the idle timeout. Carriers are reused
+ * only for tasks of the same stack size, as the stack of a system thread cannot be resized.
+ */
+class ThreadCache : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @class Carrier
+     * @brief System thread of the cache.
+     */
+    class Carrier;
+
+    /**
+     * @brief Constructor.
+     */
+    ThreadCache() noexcept;
+
+    /**
+     * @brief Destructor.
+     *
+     * Parked carriers are stopped, and carriers running tasks exit when the tasks return.
+     */
+    ~ThreadCache() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @brief Takes a parked carrier or creates a new one.
+     *
+     * @param stackSize Stack size of the task the carrier is taken for.
+     * @return The carrier, or NULLPTR if the cache is disabled or has no free carriers.
+     */
+    Carrier* acquire(size_t stackSize) noexcept;
+
+private:
+
+    /**
+     * @struct Pool
+     * @brief Static memory of the carriers.
+     */
+    struct Pool;
+
+    /**
+     * @brief Parks a carrier released by its thread object and its task.
+     *
+     * @param carrier The carrier.
+     */
+    static void park(Carrier& carrier) noexcept;
+
+    /**
+     * @brief Closes handles of a carrier which has exited or exits.
+     *
+     * @param carrier The carrier.
+     */
+    static void close(Carrier& carrier) noexcept;
+
+    /**
+     * @brief Runs a carrier.
+     *
+     * @param argument The carrier.
+     * @return Thread execution result.
+     */
+    static ::DWORD run(::LPVOID argument);
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    ThreadCache(ThreadCache const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    ThreadCache& operator=(ThreadCache const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    ThreadCache(ThreadCache&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    ThreadCache& operator=(ThreadCache&&) & noexcept = delete;
+
+    /**
+     * @brief The static memory.
+     */
+    static Pool pool_;
+
+};
+
+/**
+ * @class ThreadCache::Carrier
+ * @brief System thread of the cache.
+ */
+class ThreadCache::Carrier : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Carrier() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Carrier() noexcept override = default;
+
+    /**
+     * @brief Starts a task on the carrier.
+     *
+     * @param task The task.
+     * @return True if the task has been passed to the carrier.
+     */
+    bool_t execute(api::Task& task) noexcept;
+
+    /**
+     * @brief Releases the carrier by its thread object.
+     */
+    void release() noexcept;
+
+    /**
+     * @brief Returns the event which is set when the task has returned.
+     *
+     * @return The manual-reset event.
+     */
+    ::HANDLE getDoneEvent() const noexcept;
+
+    /**
+     * @brief Returns the system thread.
+     *
+     * @return The thread handle.
+     */
+    ::HANDLE getHandle() const noexcept;
+
+private:
+
+    friend class ThreadCache;
+
+    /**
+     * @brief Drops a reference to the carrier, and parks it if it is the last one.
+     */
+    void unreference() noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    Carrier(Carrier const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    Carrier& operator=(Carrier const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    Carrier(Carrier&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    Carrier& operator=(Carrier&&) & noexcept = delete;
+
+    /**
+     * @brief The carrier has no system thread.
+     */
+    static const int32_t STATE_FREE{ 0 };
+
+    /**
+     * @brief The carrier is held by a thread object or a task.
+     */
+    static const int32_t STATE_BUSY{ 1 };
+
+    /**
+     * @brief The carrier waits for a new task.
+     */
+    static const int32_t STATE_IDLE{ 2 };
+
+    /**
+     * @brief The system thread exits or has exited, and its handles are not closed.
+     */
+    static const int32_t STATE_DEAD{ 3 };
+
+    /**
+     * @brief State of the carrier, which is changed under the lock of the cache.
+     */
+    int32_t state_{ STATE_FREE };
+
+    /**
+     * @brief Number of the thread object and the task holding the carrier.
+     */
+    ::LONG volatile references_{ 0 };
+
+    /**
+     * @brief The task to run, or NULLPTR to exit.
+     */
+    api::Task* volatile task_{ NULLPTR };
+
+    /**
+     * @brief Stack size of the system thread.
+     */
+    size_t stackSize_{ 0U };
+
+    /**
+     * @brief Auto-reset event of passing a task.
+     */
+    ::HANDLE start_{ NULLPTR };
+
+    /**
+     * @brief Manual-reset event of returning from a task.
+     */
+    ::HANDLE done_{ NULLPTR };
+
+    /**
+     * @brief The system thread.
+     */
+    ::HANDLE handle_{ NULLPTR };
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADCACHE_HPP_
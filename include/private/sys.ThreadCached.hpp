@@ -0,0 +1,328 @@
+/**
+ * @file      sys.ThreadCached.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADCACHED_HPP_
+#define SYS_THREADCACHED_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.AffineThread.hpp"
+#include "sys.ThreadCache.hpp"
+#include "sys.Timeout.hpp"
+#include "sys.ThreadPriority.hpp"
+#include "sys.ThreadAffinity.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadCached
+ * @brief Thread class running its task on a system thread of the cache.
+ *
+ * The thread terminates when its task returns, and the system thread is reused for other tasks.
+ * As the system thread keeps a priority and a placement of a previous task, they are applied on execution.
+ *
+ * @tparam A Heap memory allocator class.
+ */
+template <class A>
+class ThreadCached : public NonCopyable<A>, public AffineThread
+{
+    using Parent = NonCopyable<A>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param task    A task interface whose main function is invoked when this thread is started.
+     * @param carrier A carrier taken from the cache, which is released by this thread.
+     */
+    ThreadCached(api::Task& task, ThreadCache::Carrier& carrier) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ThreadCached() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::api::Thread::execute()
+     */
+    bool_t execute() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Thread::join()
+     */
+    bool_t join() noexcept override;
+
+    /**
+     * @copydoc eoos::sys::TimedThread::join(uint64_t)
+     */
+    bool_t join(uint64_t timeoutUs) noexcept override;
+
+    /**
+     * @copydoc eoos::api::Thread::getPriority()
+     */
+    int32_t getPriority() const noexcept override;
+
+    /**
+     * @copydoc eoos::api::Thread::setPriority(int32_t)
+     */
+    bool_t setPriority(int32_t priority) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::AffineThread::setAffinity(uint16_t,uint64_t)
+     */
+    bool_t setAffinity(uint16_t group, uint64_t mask) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::AffineThread::setIdealProcessor(uint32_t)
+     */
+    bool_t setIdealProcessor(uint32_t number) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::AffineThread::setNode(int32_t)
+     */
+    bool_t setNode(int32_t node) noexcept override;
+
+    /**
+     * @copydoc eoos::sys::AffineThread::getNode()
+     */
+    int32_t getNode() const noexcept override;
+
+private:
+
+    /**
+     * @copydoc eoos::sys::Waitable::getWaitHandle()
+     */
+    void* getWaitHandle() noexcept override;
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    ThreadCached(ThreadCached const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    ThreadCached& operator=(ThreadCached const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    ThreadCached(ThreadCached&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    ThreadCached& operator=(ThreadCached&&) & noexcept = delete;
+
+    /**
+     * @brief User executing runnable interface.
+     */
+    api::Task* task_;
+
+    /**
+     * @brief The system thread.
+     */
+    ThreadCache::Carrier* carrier_;
+
+    /**
+     * @brief Current status.
+     */
+    Status status_;
+
+    /**
+     * @brief This thread priority.
+     */
+    int32_t priority_;
+
+    /**
+     * @brief Placement of this thread on processors.
+     */
+    ThreadAffinity affinity_;
+
+};
+
+template <class A>
+ThreadCached<A>::ThreadCached(api::Task& task, ThreadCache::Carrier& carrier) noexcept ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+    : NonCopyable<A>()
+    , AffineThread()
+    , task_(&task)
+    , carrier_(&carrier)
+    , status_(STATUS_NEW)
+    , priority_(PRIORITY_NORM)
+    , affinity_() {
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+template <class A>
+ThreadCached<A>::~ThreadCached() noexcept
+{
+    if(carrier_ != NULLPTR)
+    {
+        // The carrier stays with a running task, and it is parked when the task returns
+        carrier_->release();
+        status_ = STATUS_DEAD;
+        carrier_ = NULLPTR;
+    }
+}
+
+template <class A>
+bool_t ThreadCached<A>::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+template <class A>
+bool_t ThreadCached<A>::execute() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (status_ == STATUS_NEW) )
+    {
+        ::HANDLE const handle{ carrier_->getHandle() };
+        if( ThreadPriority::apply(handle, priority_) && affinity_.apply(handle) && carrier_->execute(*task_) )
+        {
+            status_ = STATUS_RUNNABLE;
+            res = true;
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    status_ = STATUS_DEAD;
+    return false;
+}
+
+template <class A>
+bool_t ThreadCached<A>::join() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (status_ == STATUS_RUNNABLE) )
+    {
+        ::DWORD const error{ ::WaitForSingleObject(carrier_->getDoneEvent(), INFINITE) };
+        res = (error == 0U) ? true : false;
+        status_ = STATUS_DEAD;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+bool_t ThreadCached<A>::join(uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() && (status_ == STATUS_RUNNABLE) )
+    {
+        Timeout timeout( timeoutUs );
+        if( timeout.isConstructed() )
+        {
+            ::DWORD const error{ timeout.wait(carrier_->getDoneEvent()) };
+            // The thread stays joinable if its task has not returned
+            if( error != static_cast< ::DWORD >(WAIT_TIMEOUT) )
+            {
+                res = (error == 0U) ? true : false;
+                status_ = STATUS_DEAD;
+            }
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+template <class A>
+int32_t ThreadCached<A>::getPriority() const noexcept
+{
+    return isConstructed() ? priority_ : PRIORITY_WRONG;
+}
+
+template <class A>
+bool_t ThreadCached<A>::setPriority(int32_t priority) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() && ThreadPriority::isValid(priority) )
+    {
+        // The system thread runs the task only while it is runnable
+        if( (status_ != STATUS_RUNNABLE) || ThreadPriority::apply(carrier_->getHandle(), priority) )
+        {
+            priority_ = priority;
+            res = true;
+        }
+    }
+    return res;
+}
+
+template <class A>
+bool_t ThreadCached<A>::setAffinity(uint16_t group, uint64_t mask) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        // The placement is applied on execution if the task is not running
+        ::HANDLE const handle{ (status_ == STATUS_RUNNABLE) ? carrier_->getHandle() : NULLPTR };
+        res = affinity_.setAffinity(group, mask, handle);
+    }
+    return res;
+}
+
+template <class A>
+bool_t ThreadCached<A>::setIdealProcessor(uint32_t number) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::HANDLE const handle{ (status_ == STATUS_RUNNABLE) ? carrier_->getHandle() : NULLPTR };
+        res = affinity_.setIdealProcessor(number, handle);
+    }
+    return res;
+}
+
+template <class A>
+bool_t ThreadCached<A>::setNode(int32_t node) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::HANDLE const handle{ (status_ == STATUS_RUNNABLE) ? carrier_->getHandle() : NULLPTR };
+        res = affinity_.setNode(node, handle);
+    }
+    return res;
+}
+
+template <class A>
+int32_t ThreadCached<A>::getNode() const noexcept
+{
+    return affinity_.getNode();
+}
+
+template <class A>
+void* ThreadCached<A>::getWaitHandle() noexcept
+{
+    return isConstructed() ? carrier_->getDoneEvent() : NULLPTR;
+}
+
+template <class A>
+bool_t ThreadCached<A>::construct() noexcept
+{
+    return isConstructed() && Parent::isConstructed(task_);
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADCACHED_HPP_
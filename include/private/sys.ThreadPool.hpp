@@ -0,0 +1,232 @@
+/**
+ * @file      sys.ThreadPool.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADPOOL_HPP_
+#define SYS_THREADPOOL_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Executor.hpp"
+#include "sys.Topology.hpp"
+
+#ifndef EOOS_GLOBAL_SYS_NUMBER_OF_WORKERS
+/**
+ * @brief Maximum number of executor threads, which is also limited by the number of processors.
+ */
+#define EOOS_GLOBAL_SYS_NUMBER_OF_WORKERS (64)
+#endif // EOOS_GLOBAL_SYS_NUMBER_OF_WORKERS
+
+#ifndef EOOS_GLOBAL_SYS_EXECUTOR_QUEUE_SIZE
+/**
+ * @brief Number of tasks each executor queue holds, which shall be a power of two.
+ */
+#define EOOS_GLOBAL_SYS_EXECUTOR_QUEUE_SIZE (1024)
+#endif // EOOS_GLOBAL_SYS_EXECUTOR_QUEUE_SIZE
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadPool.
+ * @brief Work-stealing thread pool.
+ *
+ * Each worker thread owns a deque of tasks, it pushes and pops the tasks it submits itself
+ * at the bottom of its deque, and other workers steal tasks from the top of the deque
+ * beginning with a random worker. Tasks submitted by other threads are put to a shared queue.
+ * A worker which has found no tasks parks on a semaphore, which a submitting thread releases
+ * only if a worker is parked. The workers are started when the first task is submitted, and
+ * they are joined when the pool is destroyed after they have executed all the tasks queued,
+ * so the tasks shall not block for long.
+ */
+class ThreadPool : public NonCopyable<NoAllocator>, public Executor
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param topology The topology of processors, which gives the number of workers.
+     */
+    explicit ThreadPool(Topology& topology) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ThreadPool() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @copydoc eoos::sys::Executor::submit(api::Task&)
+     */
+    bool_t submit(api::Task& task) noexcept override; ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+
+    /**
+     * @copydoc eoos::sys::Executor::getNumberOfWorkers()
+     */
+    int32_t getNumberOfWorkers() const noexcept override;
+
+private:
+
+    /**
+     * @class Worker
+     * @brief Worker thread with its deque of tasks.
+     */
+    class Worker;
+
+    /**
+     * @struct Pool
+     * @brief Static memory of the workers and the shared queue.
+     */
+    struct Pool;
+
+    /**
+     * @brief Constructor.
+     *
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct() noexcept;
+
+    /**
+     * @brief Starts the workers if they have not been started.
+     *
+     * @return True if the workers are started.
+     */
+    bool_t start() noexcept;
+
+    /**
+     * @brief Executes tasks by a worker until the pool is stopped.
+     *
+     * @param worker The worker.
+     */
+    void execute(Worker& worker) noexcept;
+
+    /**
+     * @brief Takes a task for a worker.
+     *
+     * @param worker The worker.
+     * @return The task, or NULLPTR if no tasks found.
+     */
+    api::Task* take(Worker& worker) noexcept;
+
+    /**
+     * @brief Parks the calling worker until a task is submitted.
+     */
+    void park() noexcept;
+
+    /**
+     * @brief Wakes up a parked worker if a worker is parked.
+     */
+    void wakeUp() noexcept;
+
+    /**
+     * @brief Tests if there are tasks in the queues.
+     *
+     * @return True if a queue is not empty.
+     */
+    bool_t hasTasks() const noexcept;
+
+    /**
+     * @brief Puts a task to the shared queue.
+     *
+     * @param task The task.
+     * @return True if the task has been put.
+     */
+    static bool_t put(api::Task* task) noexcept;
+
+    /**
+     * @brief Gets a task from the shared queue.
+     *
+     * @return The task, or NULLPTR if the queue is empty.
+     */
+    static api::Task* get() noexcept;
+
+    /**
+     * @brief Runs a worker thread.
+     *
+     * @param argument The worker.
+     * @return Thread execution result.
+     */
+    static ::DWORD run(::LPVOID argument);
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    ThreadPool(ThreadPool const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    ThreadPool& operator=(ThreadPool const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    ThreadPool(ThreadPool&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    ThreadPool& operator=(ThreadPool&&) & noexcept = delete;
+
+    /**
+     * @brief Maximum count of the semaphore.
+     *
+     * Permits released for workers which have taken a place of a woken one stay in the semaphore,
+     * so the count is not limited by the number of workers to let all the workers be released on stopping.
+     */
+    static const ::LONG MAXIMUM_COUNT{ 0x7FFFFFFF };
+
+    /**
+     * @brief The topology of processors.
+     */
+    Topology& topology_;
+
+    /**
+     * @brief Number of the workers started.
+     */
+    ::LONG volatile numberOfWorkers_{ 0 };
+
+    /**
+     * @brief Number of parked workers.
+     */
+    ::LONG volatile numberOfParked_{ 0 };
+
+    /**
+     * @brief The pool is stopped.
+     */
+    ::LONG volatile isStopped_{ 0 };
+
+    /**
+     * @brief Lock of starting the workers.
+     */
+    ::SRWLOCK startLock_ = SRWLOCK_INIT;
+
+    /**
+     * @brief Semaphore the parked workers wait on.
+     */
+    ::HANDLE semaphore_{ NULLPTR };
+
+    /**
+     * @brief TLS index of the worker of the current thread.
+     */
+    ::DWORD tlsIndex_{ TLS_OUT_OF_INDEXES };
+
+    /**
+     * @brief The static memory.
+     */
+    static Pool pool_;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADPOOL_HPP_
@@ -0,0 +1,59 @@
+/**
+ * @file      sys.ThreadPriority.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADPRIORITY_HPP_
+#define SYS_THREADPRIORITY_HPP_
+
+#include "sys.Types.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadPriority
+ * @brief Mapping of thread priorities onto system thread priorities.
+ *
+ * The normal priority is mapped to the normal system priority, the priorities around it
+ * are mapped to the above and below normal system priorities, the farther ones to the highest
+ * and lowest system priorities, the maximum one to the time-critical system priority,
+ * and the idle priority to the idle system priority.
+ */
+class ThreadPriority
+{
+
+public:
+
+    /**
+     * @brief Tests if a priority is a priority of a thread.
+     *
+     * @param priority The priority.
+     * @return True if the priority is in the range or it is the idle priority.
+     */
+    static bool_t isValid(int32_t priority) noexcept;
+
+    /**
+     * @brief Converts a priority to a system thread priority.
+     *
+     * @param priority A valid priority.
+     * @return The system thread priority.
+     */
+    static int convert(int32_t priority) noexcept;
+
+    /**
+     * @brief Sets a priority of a system thread.
+     *
+     * @param handle   The system thread.
+     * @param priority A valid priority.
+     * @return True if the priority has been set.
+     */
+    static bool_t apply(::HANDLE handle, int32_t priority) noexcept;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADPRIORITY_HPP_
@@ -0,0 +1,120 @@
+/**
+ * @file      sys.TimedLockWaiter.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TIMEDLOCKWAITER_HPP_
+#define SYS_TIMEDLOCKWAITER_HPP_
+
+#include "sys.NonCopyable.hpp"
+#include "sys.Timeout.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class TimedLockWaiter.
+ * @brief Waiter for a lock which has no timed wait.
+ *
+ * A thread locking with a timeout sleeps on the address of a release counter until the deadline,
+ * and unlocking threads bump the counter and wake sleeping threads up only if timed waiters exist.
+ * A lock using the waiter has a private function tryTake() which tries to take the lock once,
+ * and it makes the waiter its friend.
+ */
+class TimedLockWaiter : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    TimedLockWaiter() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~TimedLockWaiter() noexcept override = default;
+
+    /**
+     * @brief Waits until the lock is taken or the deadline.
+     *
+     * @param lock    The lock.
+     * @param timeout The deadline.
+     * @return True if the lock has been taken.
+     */
+    template <class T>
+    bool_t wait(T& lock, Timeout& timeout) noexcept;
+
+    /**
+     * @brief Wakes timed waiters up after the lock has been released.
+     *
+     * The release of the lock shall be an interlocked operation, so the waiters are counted after it.
+     */
+    void notify() noexcept;
+
+private:
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    TimedLockWaiter(TimedLockWaiter const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    TimedLockWaiter& operator=(TimedLockWaiter const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    TimedLockWaiter(TimedLockWaiter&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    TimedLockWaiter& operator=(TimedLockWaiter&&) & noexcept = delete;
+
+    /**
+     * @brief Number of threads waiting for the lock with a timeout.
+     */
+    volatile ::LONG timedWaiters_{ 0 };
+
+    /**
+     * @brief Number of unlocks done while timed waiters exist, which the waiters sleep on.
+     */
+    volatile ::LONG releases_{ 0 };
+
+};
+
+template <class T>
+bool_t TimedLockWaiter::wait(T& lock, Timeout& timeout) noexcept
+{
+    bool_t res{ false };
+    static_cast<void>( ::InterlockedIncrement(&timedWaiters_) );
+    bool_t isExpired{ false };
+    while( (res == false) && (!isExpired) )
+    {
+        // Read the counter before trying to not miss an unlock done before the sleeping
+        ::LONG releases{ releases_ };
+        res = lock.tryTake();
+        if(res == false)
+        {
+            ::DWORD const ms{ timeout.getMilliseconds() };
+            isExpired = ms == 0U;
+            if(!isExpired)
+            {
+                static_cast<void>( ::WaitOnAddress(&releases_, &releases, sizeof(releases), ms) );
+            }
+        }
+    }
+    static_cast<void>( ::InterlockedDecrement(&timedWaiters_) );
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TIMEDLOCKWAITER_HPP_
@@ -0,0 +1,167 @@
+/**
+ * @file      sys.Timeout.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TIMEOUT_HPP_
+#define SYS_TIMEOUT_HPP_
+
+#include "sys.NonCopyable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Timeout.
+ * @brief Deadline of a timed wait.
+ *
+ * The deadline is measured with the performance counter. Waits on kernel objects are bounded
+ * by a high-resolution waitable timer, or by a regular one if the system has no high-resolution
+ * timers. The timer is created only if objects are not signaled at once. Waits on addresses
+ * are bounded by the remaining time rounded up to milliseconds.
+ */
+class Timeout : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param us Timeout in microseconds.
+     */
+    explicit Timeout(uint64_t us) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Timeout() noexcept override;
+
+    /**
+     * @copydoc eoos::api::Object::isConstructed()
+     */
+    bool_t isConstructed() const noexcept override;
+
+    /**
+     * @brief Tests if the deadline has passed.
+     *
+     * @return True if the timeout has expired.
+     */
+    bool_t isExpired() const noexcept;
+
+    /**
+     * @brief Waits for a kernel object until the deadline.
+     *
+     * @param handle The kernel object.
+     * @return WAIT_OBJECT_0 if the object is signaled, WAIT_TIMEOUT if the timeout has expired,
+     *         or another value of WaitForSingleObject if an error has been occurred.
+     */
+    ::DWORD wait(::HANDLE handle) noexcept;
+
+    /**
+     * @brief Waits for kernel objects until the deadline.
+     *
+     * Waiting for any object is bounded by the timer, which is waited for together with the objects.
+     * Waiting for all objects cannot be bounded by the timer, so it has the resolution of the kernel timer.
+     *
+     * @param handles The kernel objects.
+     * @param number  Number of the objects, which is less than MAXIMUM_WAIT_OBJECTS.
+     * @param isAll   Wait for all the objects, otherwise wait for any object.
+     * @return A value of WaitForMultipleObjects.
+     */
+    ::DWORD wait(::HANDLE const* handles, ::DWORD number, bool_t isAll) noexcept;
+
+    /**
+     * @brief Returns the time remaining to the deadline for waits bounded in milliseconds.
+     *
+     * @return Remaining time rounded up to milliseconds and less than INFINITE, or zero if the timeout has expired.
+     */
+    ::DWORD getMilliseconds() const noexcept;
+
+private:
+
+    /**
+     * @brief Constructor.
+     *
+     * @param us Timeout in microseconds.
+     * @return True if object has been constructed successfully.
+     */
+    bool_t construct(uint64_t us) noexcept;
+
+    /**
+     * @brief Returns the remaining time.
+     *
+     * @return Remaining time in performance counter ticks, or zero if the timeout has expired.
+     */
+    ::LONGLONG getRemaining() const noexcept;
+
+    /**
+     * @brief Sets the waitable timer creating the timer if it does not exist.
+     *
+     * @param ticks Time to the timer expiration in performance counter ticks.
+     * @return The timer handle, or a null pointer if an error has been occurred.
+     */
+    ::HANDLE setTimer(::LONGLONG ticks) noexcept;
+
+    /**
+     * @brief Converts performance counter ticks to other units rounding up.
+     *
+     * @param ticks Performance counter ticks.
+     * @param units Number of units in a second.
+     * @return The time in the units.
+     */
+    ::LONGLONG convert(::LONGLONG ticks, ::LONGLONG units) const noexcept;
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    Timeout(Timeout const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    Timeout& operator=(Timeout const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    Timeout(Timeout&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    Timeout& operator=(Timeout&&) & noexcept = delete;
+
+    /**
+     * @brief The timer is high resolution, which is supported since Windows 10 version 1803.
+     */
+    static const ::DWORD WIN32_CREATE_WAITABLE_TIMER_HIGH_RESOLUTION{ 0x00000002U };
+
+    /**
+     * @brief Access rights of the timer.
+     */
+    static const ::DWORD WIN32_TIMER_ALL_ACCESS{ 0x001F0003U };
+
+    /**
+     * @brief Performance counter frequency.
+     */
+    ::LONGLONG frequency_{ 0 };
+
+    /**
+     * @brief Performance counter value of the deadline.
+     */
+    ::LONGLONG deadline_{ 0 };
+
+    /**
+     * @brief The waitable timer.
+     */
+    ::HANDLE timer_{ NULLPTR };
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TIMEOUT_HPP_
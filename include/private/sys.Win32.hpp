@@ -9,5 +9,6 @@
 #define SYS_WIN32_HPP_
 
 #include <Windows.h>
+#include <Psapi.h>
 
 #endif // SYS_WIN32_HPP_
@@ -0,0 +1,75 @@
+/**
+ * @file      sys.AffineThread.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_AFFINETHREAD_HPP_
+#define SYS_AFFINETHREAD_HPP_
+
+#include "sys.TimedThread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class AffineThread
+ * @brief Thread interface placing the thread on processors.
+ *
+ * Memory pages are placed on the NUMA node of the processor which touches them first,
+ * thus a thread placed before it is executed has its stack and the heap slabs it creates
+ * on its node.
+ */
+class AffineThread : public TimedThread
+{
+
+public:
+
+    /**
+     * @brief The thread is not restricted to a NUMA node.
+     */
+    static const int32_t NODE_ANY{ -1 };
+
+    /**
+     * @brief Destructor.
+     */
+    ~AffineThread() noexcept override = default;
+
+    /**
+     * @brief Restricts the thread to processors of a processor group.
+     *
+     * @param group Index of the processor group.
+     * @param mask  Mask of the processors in the group, which shall not be zero.
+     * @return True if the affinity has been set.
+     */
+    virtual bool_t setAffinity(uint16_t group, uint64_t mask) noexcept = 0;
+
+    /**
+     * @brief Sets the processor the system prefers to run the thread on.
+     *
+     * @param number Number of the processor in the group of the thread.
+     * @return True if the hint has been set.
+     */
+    virtual bool_t setIdealProcessor(uint32_t number) noexcept = 0;
+
+    /**
+     * @brief Restricts the thread to processors of a NUMA node.
+     *
+     * @param node Number of the node, or NODE_ANY to run the thread on all processors of the process.
+     * @return True if the node has been set.
+     */
+    virtual bool_t setNode(int32_t node) noexcept = 0;
+
+    /**
+     * @brief Returns the NUMA node the thread is restricted to.
+     *
+     * @return Number of the node, or NODE_ANY.
+     */
+    virtual int32_t getNode() const noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_AFFINETHREAD_HPP_
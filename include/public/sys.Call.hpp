@@ -7,6 +7,19 @@
 #define SYS_CALL_HPP_
 
 #include "api.System.hpp"
+#include "sys.HeapStatistics.hpp"
+#include "sys.HeapTrace.hpp"
+#include "sys.HeapBenchmark.hpp"
+#include "sys.MutexFactory.hpp"
+#include "sys.RwLockFactory.hpp"
+#include "sys.SemaphoreFactory.hpp"
+#include "sys.ConditionFactory.hpp"
+#include "sys.MultiWait.hpp"
+#include "sys.LockStatistics.hpp"
+#include "sys.ThreadFactory.hpp"
+#include "sys.Executor.hpp"
+#include "sys.ProcessPriority.hpp"
+#include "sys.Topology.hpp"
 
 namespace eoos
 {
@@ -29,6 +42,97 @@ public:
      */
     static api::System& get() noexcept;
 
+    /**
+     * @brief Returns the heap statistics of the operating system.
+     *
+     * @return The heap statistics.
+     */
+    static HeapStatistics& getHeapStatistics() noexcept;
+
+    /**
+     * @brief Returns the heap allocation trace of the operating system.
+     *
+     * @return The heap allocation trace.
+     */
+    static HeapTrace& getHeapTrace() noexcept;
+
+    /**
+     * @brief Returns the heap allocation trace replay of the operating system.
+     *
+     * @return The heap allocation trace replay.
+     */
+    static HeapBenchmark& getHeapBenchmark() noexcept;
+
+    /**
+     * @brief Returns the mutex factory of the operating system.
+     *
+     * @return The mutex factory.
+     */
+    static MutexFactory& getMutexFactory() noexcept;
+
+    /**
+     * @brief Returns the reader-writer lock factory of the operating system.
+     *
+     * @return The reader-writer lock factory.
+     */
+    static RwLockFactory& getRwLockFactory() noexcept;
+
+    /**
+     * @brief Returns the semaphore factory of the operating system.
+     *
+     * @return The semaphore factory.
+     */
+    static SemaphoreFactory& getSemaphoreFactory() noexcept;
+
+    /**
+     * @brief Returns the condition variable and event factory of the operating system.
+     *
+     * @return The condition variable and event factory.
+     */
+    static ConditionFactory& getConditionFactory() noexcept;
+
+    /**
+     * @brief Returns the waiting for many objects at once of the operating system.
+     *
+     * @return The waiting for many objects.
+     */
+    static MultiWait& getMultiWait() noexcept;
+
+    /**
+     * @brief Returns the thread factory of the operating system.
+     *
+     * @return The thread factory.
+     */
+    static ThreadFactory& getThreadFactory() noexcept;
+
+    /**
+     * @brief Returns the executor of short tasks of the operating system.
+     *
+     * @return The executor.
+     */
+    static Executor& getExecutor() noexcept;
+
+    /**
+     * @brief Returns the priority class of the process of the operating system.
+     *
+     * @return The process priority.
+     */
+    static ProcessPriority& getProcessPriority() noexcept;
+
+    /**
+     * @brief Returns the topology of processors of the operating system.
+     *
+     * @return The topology.
+     */
+    static Topology& getTopology() noexcept;
+
+    /**
+     * @brief Returns the lock contention statistics of the operating system.
+     *
+     * @return The lock contention statistics.
+     */
+    static LockStatistics& getLockStatistics() noexcept;
+
 };
 
 } // namespace sys
@@ -0,0 +1,52 @@
+/**
+ * @file      sys.ConditionFactory.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONDITIONFACTORY_HPP_
+#define SYS_CONDITIONFACTORY_HPP_
+
+#include "api.Object.hpp"
+#include "sys.ConditionVariable.hpp"
+#include "sys.Event.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ConditionFactory
+ * @brief Factory of condition variables and events.
+ */
+class ConditionFactory : public api::Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~ConditionFactory() noexcept override = default;
+
+    /**
+     * @brief Creates a new condition variable.
+     *
+     * @return A new condition variable, or NULLPTR if an error has been occurred.
+     */
+    virtual ConditionVariable* createConditionVariable() noexcept = 0;
+
+    /**
+     * @brief Creates a new event.
+     *
+     * @param isManualReset The event is reset manually, otherwise it is reset when a waiting thread is released.
+     * @param isSet         The initial state of the event.
+     * @return A new event, or NULLPTR if an error has been occurred.
+     */
+    virtual Event* createEvent(bool_t isManualReset, bool_t isSet) noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONDITIONFACTORY_HPP_
@@ -0,0 +1,98 @@
+/**
+ * @file      sys.ConditionVariable.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_CONDITIONVARIABLE_HPP_
+#define SYS_CONDITIONVARIABLE_HPP_
+
+#include "api.Object.hpp"
+#include "api.Mutex.hpp"
+#include "sys.TimedMutex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ConditionVariable
+ * @brief Condition variable interface.
+ *
+ * A thread waits on the variable holding a mutex, which is unlocked while the thread waits
+ * and locked again before the thread returns. A waiting thread might be woken up spuriously,
+ * thus it shall test its condition again after it has returned.
+ *
+ * The mutex is unlocked once, so it shall not be locked recursively by the waiting thread.
+ * Waits given a timed mutex check this and fail if the mutex is locked recursively.
+ * Waits given an api::Mutex reference cannot check this, even if it refers to a timed mutex.
+ */
+class ConditionVariable : public api::Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~ConditionVariable() noexcept override = default;
+
+    /**
+     * @brief Waits until the variable is notified.
+     *
+     * If the mutex is locked recursively, it stays locked while the thread waits,
+     * so notifying threads cannot lock it and the thread might wait forever.
+     *
+     * @param mutex The mutex locked once by the calling thread.
+     * @return True if the variable has been notified.
+     */
+    virtual bool_t wait(api::Mutex& mutex) noexcept = 0;
+
+    /**
+     * @brief Waits until the variable is notified or the timeout expires.
+     *
+     * If the mutex is locked recursively, it stays locked while the thread waits,
+     * so notifying threads cannot lock it and the wait lasts until the timeout expires.
+     *
+     * @param mutex     The mutex locked once by the calling thread.
+     * @param timeoutUs Timeout in microseconds.
+     * @return True if the variable has been notified, or false if the timeout has expired.
+     */
+    virtual bool_t waitFor(api::Mutex& mutex, uint64_t timeoutUs) noexcept = 0;
+
+    /**
+     * @brief Waits until the variable is notified.
+     *
+     * @param mutex The mutex locked once by the calling thread.
+     * @return True if the variable has been notified, or false if the mutex is locked recursively.
+     */
+    virtual bool_t wait(TimedMutex& mutex) noexcept = 0;
+
+    /**
+     * @brief Waits until the variable is notified or the timeout expires.
+     *
+     * @param mutex     The mutex locked once by the calling thread.
+     * @param timeoutUs Timeout in microseconds.
+     * @return True if the variable has been notified, or false if the timeout has expired or the mutex is locked recursively.
+     */
+    virtual bool_t waitFor(TimedMutex& mutex, uint64_t timeoutUs) noexcept = 0;
+
+    /**
+     * @brief Wakes up one waiting thread.
+     *
+     * @return True if the variable has been notified.
+     */
+    virtual bool_t notifyOne() noexcept = 0;
+
+    /**
+     * @brief Wakes up all waiting threads.
+     *
+     * @return True if the variable has been notified.
+     */
+    virtual bool_t notifyAll() noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_CONDITIONVARIABLE_HPP_
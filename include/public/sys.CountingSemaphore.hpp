@@ -0,0 +1,89 @@
+/**
+ * @file      sys.CountingSemaphore.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_COUNTINGSEMAPHORE_HPP_
+#define SYS_COUNTINGSEMAPHORE_HPP_
+
+#include "api.Semaphore.hpp"
+#include "sys.Waitable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class CountingSemaphore
+ * @brief Semaphore interface moving many permits at once and waiting with timeouts.
+ */
+class CountingSemaphore : public api::Semaphore, public Waitable
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~CountingSemaphore() noexcept override = default;
+
+    /**
+     * @brief Acquires a number of permits waiting until all of them are available.
+     *
+     * The cost of acquiring many permits depends on the semaphore type, a default semaphore
+     * calls the kernel for each permit, and a light one takes all available permits at once.
+     *
+     * @param permits Number of permits greater than zero.
+     * @return True if the permits have been acquired.
+     */
+    virtual bool_t acquire(int32_t permits) noexcept = 0;
+
+    /**
+     * @brief Acquires one permit waiting until it is available or the timeout expires.
+     *
+     * @param timeoutUs Timeout in microseconds, which shall be 64-bit unsigned not to be taken for a number of permits.
+     * @return True if the permit has been acquired.
+     */
+    virtual bool_t acquire(uint64_t timeoutUs) noexcept = 0;
+
+    /**
+     * @brief Acquires a number of permits waiting until all of them are available or the timeout expires.
+     *
+     * @param permits   Number of permits greater than zero.
+     * @param timeoutUs Timeout in microseconds.
+     * @return True if the permits have been acquired, or false if no permits have been acquired.
+     */
+    virtual bool_t acquire(int32_t permits, uint64_t timeoutUs) noexcept = 0;
+
+    /**
+     * @brief Tries to acquire one permit without waiting.
+     *
+     * @return True if the permit has been acquired.
+     */
+    virtual bool_t tryAcquire() noexcept = 0;
+
+    /**
+     * @brief Tries to acquire a number of permits without waiting.
+     *
+     * @param permits Number of permits greater than zero.
+     * @return True if all the permits have been acquired, or false if no permits have been acquired.
+     */
+    virtual bool_t tryAcquire(int32_t permits) noexcept = 0;
+
+    /**
+     * @brief Releases a number of permits waking up waiting threads at once.
+     *
+     * @param permits Number of permits greater than zero.
+     * @return True if the permits have been released.
+     */
+    virtual bool_t release(int32_t permits) noexcept = 0;
+
+    using api::Semaphore::acquire;
+    using api::Semaphore::release;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_COUNTINGSEMAPHORE_HPP_
@@ -0,0 +1,67 @@
+/**
+ * @file      sys.Event.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EVENT_HPP_
+#define SYS_EVENT_HPP_
+
+#include "api.Object.hpp"
+#include "sys.Waitable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Event
+ * @brief Event interface.
+ *
+ * A manual-reset event stays set and releases all waiting threads until it is reset.
+ * An auto-reset event releases one waiting thread and is reset when the thread is released.
+ */
+class Event : public api::Object, public Waitable
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~Event() noexcept override = default;
+
+    /**
+     * @brief Sets the event.
+     *
+     * @return True if the event has been set.
+     */
+    virtual bool_t set() noexcept = 0;
+
+    /**
+     * @brief Resets the event.
+     *
+     * @return True if the event has been reset.
+     */
+    virtual bool_t reset() noexcept = 0;
+
+    /**
+     * @brief Waits until the event is set.
+     *
+     * @return True if the event has been set.
+     */
+    virtual bool_t wait() noexcept = 0;
+
+    /**
+     * @brief Waits until the event is set or the timeout expires.
+     *
+     * @param timeoutUs Timeout in microseconds.
+     * @return True if the event has been set, or false if the timeout has expired.
+     */
+    virtual bool_t waitFor(uint64_t timeoutUs) noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EVENT_HPP_
@@ -0,0 +1,57 @@
+/**
+ * @file      sys.Executor.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_EXECUTOR_HPP_
+#define SYS_EXECUTOR_HPP_
+
+#include "api.Object.hpp"
+#include "api.Task.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Executor
+ * @brief Executor of short tasks on threads which already exist.
+ */
+class Executor : public api::Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~Executor() noexcept override = default;
+
+    /**
+     * @brief Submits a task to be executed.
+     *
+     * The task is executed once by one of the executor threads, and the task shall be alive
+     * until its main function returns. Stack size of the task is not applied. The executor
+     * does not signal that the task has been executed, so the task shall signal it itself
+     * at the end of its main function, for example, releasing a semaphore the submitting thread waits on.
+     * Tasks submitted are executed before the executor is destroyed, and no tasks shall be
+     * submitted by other threads while the executor is being destroyed.
+     *
+     * @param task A task interface whose main function is invoked by an executor thread.
+     * @return True if the task has been submitted.
+     */
+    virtual bool_t submit(api::Task& task) noexcept = 0; ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+
+    /**
+     * @brief Returns the number of executor threads.
+     *
+     * @return The number of threads, or zero if the threads have not been started yet.
+     */
+    virtual int32_t getNumberOfWorkers() const noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_EXECUTOR_HPP_
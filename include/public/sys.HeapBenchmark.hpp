@@ -0,0 +1,111 @@
+/**
+ * @file      sys.HeapBenchmark.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_HEAPBENCHMARK_HPP_
+#define SYS_HEAPBENCHMARK_HPP_
+
+#include "api.Object.hpp"
+#include "api.Heap.hpp"
+#include "sys.HeapTrace.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class HeapBenchmark
+ * @brief Heap allocation trace replay interface.
+ *
+ * A trace saved from HeapTrace is replayed against a heap to evaluate the heap
+ * with a real allocation pattern instead of synthetic tests.
+ */
+class HeapBenchmark : public api::Object
+{
+
+public:
+
+    /**
+     * @struct Report
+     * @brief Results of a replay.
+     */
+    struct Report
+    {
+        /**
+         * @brief Number of replayed allocations and frees.
+         */
+        uint64_t operations;
+
+        /**
+         * @brief Number of allocations the heap has failed.
+         */
+        uint64_t failures;
+
+        /**
+         * @brief Number of operations per second.
+         */
+        uint64_t throughput;
+
+        /**
+         * @brief Median operation latency in nanoseconds.
+         */
+        uint64_t latency50;
+
+        /**
+         * @brief 90th percentile operation latency in nanoseconds.
+         */
+        uint64_t latency90;
+
+        /**
+         * @brief 99th percentile operation latency in nanoseconds.
+         */
+        uint64_t latency99;
+
+        /**
+         * @brief 99.9th percentile operation latency in nanoseconds.
+         */
+        uint64_t latency999;
+
+        /**
+         * @brief Maximum operation latency in nanoseconds.
+         */
+        uint64_t latencyMax;
+
+        /**
+         * @brief Maximum number of bytes requested and not freed at once.
+         */
+        uint64_t peakBytes;
+
+        /**
+         * @brief Peak resident set size of the process in bytes.
+         */
+        uint64_t peakResident;
+    };
+
+    /**
+     * @brief Destructor.
+     */
+    ~HeapBenchmark() noexcept override = default;
+
+    /**
+     * @brief Replays a trace against a heap.
+     *
+     * The records are replayed in order by the calling thread. Frees of blocks which
+     * have been allocated before the first record are skipped, and blocks not freed
+     * by the trace are freed after the replay without accounting.
+     *
+     * @param heap    The heap to replay the trace against.
+     * @param records Records got from HeapTrace::getRecords().
+     * @param count   Number of records.
+     * @param report  Results of the replay.
+     * @return True if the trace has been replayed.
+     */
+    virtual bool_t replay(api::Heap& heap, HeapTrace::Record const* records, size_t count, Report& report) noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_HEAPBENCHMARK_HPP_
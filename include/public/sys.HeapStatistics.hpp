@@ -0,0 +1,139 @@
+/**
+ * @file      sys.HeapStatistics.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_HEAPSTATISTICS_HPP_
+#define SYS_HEAPSTATISTICS_HPP_
+
+#include "api.Object.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class HeapStatistics
+ * @brief Heap statistics interface.
+ *
+ * Statistics are gathered only if the system is built with EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS.
+ */
+class HeapStatistics : public api::Object
+{
+
+public:
+
+    /**
+     * @struct Counters
+     * @brief Heap usage counters.
+     */
+    struct Counters
+    {
+        /**
+         * @brief Number of bytes currently allocated.
+         */
+        uint64_t liveBytes;
+
+        /**
+         * @brief Maximum number of bytes allocated at once.
+         */
+        uint64_t peakBytes;
+
+        /**
+         * @brief Number of successful allocations.
+         */
+        uint64_t allocations;
+
+        /**
+         * @brief Number of frees.
+         */
+        uint64_t frees;
+
+        /**
+         * @brief Number of failed allocations.
+         */
+        uint64_t failures;
+
+        /**
+         * @brief Number of allocations per second.
+         */
+        uint64_t allocationRate;
+    };
+
+    /**
+     * @brief Number of histogram bins, where a bin N counts allocations of 2^N to 2^(N+1)-1 bytes.
+     */
+    static const int32_t NUMBER_OF_BINS{ 32 };
+
+    /**
+     * @brief Number of caller tags.
+     */
+    static const int32_t NUMBER_OF_TAGS{ 16 };
+
+    /**
+     * @brief Destructor.
+     */
+    ~HeapStatistics() noexcept override = default;
+
+    /**
+     * @brief Tests if statistics are gathered.
+     *
+     * @return True if statistics are gathered.
+     */
+    virtual bool_t isEnabled() const noexcept = 0;
+
+    /**
+     * @brief Returns heap usage counters.
+     *
+     * The allocation rate is calculated from the last reset of the statistics.
+     *
+     * @param counters Counters to fill.
+     * @return True if the counters have been filled.
+     */
+    virtual bool_t getCounters(Counters& counters) const noexcept = 0;
+
+    /**
+     * @brief Returns number of allocations of a size histogram bin.
+     *
+     * @param bin Index of the bin from 0 to NUMBER_OF_BINS - 1.
+     * @return Number of allocations.
+     */
+    virtual uint64_t getHistogram(int32_t bin) const noexcept = 0;
+
+    /**
+     * @brief Returns number of allocations done by callers with a tag.
+     *
+     * @param tag The tag from 0 to NUMBER_OF_TAGS - 1.
+     * @return Number of allocations.
+     */
+    virtual uint64_t getTagAllocations(int32_t tag) const noexcept = 0;
+
+    /**
+     * @brief Returns number of bytes allocated by callers with a tag.
+     *
+     * @param tag The tag from 0 to NUMBER_OF_TAGS - 1.
+     * @return Number of bytes.
+     */
+    virtual uint64_t getTagBytes(int32_t tag) const noexcept = 0;
+
+    /**
+     * @brief Sets a tag of the calling thread to account next allocations to.
+     *
+     * A thread has zero tag by default.
+     *
+     * @param tag The tag from 0 to NUMBER_OF_TAGS - 1.
+     * @return The previous tag of the thread, or -1 if the tag has not been set.
+     */
+    virtual int32_t setTag(int32_t tag) noexcept = 0;
+
+    /**
+     * @brief Resets all statistics except the number of bytes currently allocated.
+     */
+    virtual void reset() noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_HEAPSTATISTICS_HPP_
@@ -0,0 +1,122 @@
+/**
+ * @file      sys.HeapTrace.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_HEAPTRACE_HPP_
+#define SYS_HEAPTRACE_HPP_
+
+#include "api.Object.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class HeapTrace
+ * @brief Heap allocation trace interface.
+ *
+ * The trace keeps the latest allocations and frees in a ring buffer, thus
+ * a record of a real allocation pattern can be saved and replayed later.
+ * Allocations and frees are recorded only if the system is built with
+ * EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE and recording has been started.
+ */
+class HeapTrace : public api::Object
+{
+
+public:
+
+    /**
+     * @struct Record
+     * @brief Record of one allocation or free.
+     */
+    struct Record
+    {
+        /**
+         * @brief Time of the operation in ticks of getFrequency() per second.
+         */
+        uint64_t timestamp;
+
+        /**
+         * @brief Address of the block, which pairs a free with its allocation.
+         */
+        uint64_t address;
+
+        /**
+         * @brief Number of bytes allocated, or FREE if the block has been freed.
+         */
+        uint32_t size;
+
+        /**
+         * @brief Identifier of the thread which has done the operation.
+         */
+        uint32_t thread;
+    };
+
+    /**
+     * @brief Size value of free records.
+     */
+    static const uint32_t FREE{ 0xFFFFFFFFU };
+
+    /**
+     * @brief Destructor.
+     */
+    ~HeapTrace() noexcept override = default;
+
+    /**
+     * @brief Tests if the trace can be recorded.
+     *
+     * @return True if the trace can be recorded.
+     */
+    virtual bool_t isEnabled() const noexcept = 0;
+
+    /**
+     * @brief Starts recording.
+     *
+     * @return True if recording has been started.
+     */
+    virtual bool_t start() noexcept = 0;
+
+    /**
+     * @brief Stops recording.
+     */
+    virtual void stop() noexcept = 0;
+
+    /**
+     * @brief Returns frequency of record timestamps.
+     *
+     * @return Number of ticks per second.
+     */
+    virtual uint64_t getFrequency() const noexcept = 0;
+
+    /**
+     * @brief Returns number of records done from the last reset.
+     *
+     * The number might exceed the ring buffer capacity, then the oldest records are lost.
+     *
+     * @return Number of records.
+     */
+    virtual uint64_t getNumberOfRecords() const noexcept = 0;
+
+    /**
+     * @brief Copies the latest records in order they have been done.
+     *
+     * Records copied while recording is going on might be incomplete, so recording should be stopped before.
+     *
+     * @param records Buffer to copy to.
+     * @param count   Number of records the buffer can keep.
+     * @return Number of copied records.
+     */
+    virtual size_t getRecords(Record* records, size_t count) const noexcept = 0;
+
+    /**
+     * @brief Removes all records.
+     */
+    virtual void reset() noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_HEAPTRACE_HPP_
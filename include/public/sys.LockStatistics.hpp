@@ -0,0 +1,137 @@
+/**
+ * @file      sys.LockStatistics.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_LOCKSTATISTICS_HPP_
+#define SYS_LOCKSTATISTICS_HPP_
+
+#include "api.Object.hpp"
+#include "api.OutStream.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class LockStatistics
+ * @brief Lock contention statistics interface.
+ *
+ * Statistics of each mutex and semaphore of any type are gathered only if the system is built
+ * with EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER. Reader-writer locks are not profiled.
+ */
+class LockStatistics : public api::Object
+{
+
+public:
+
+    /**
+     * @enum  Type
+     * @brief Lock types.
+     */
+    enum class Type : int32_t
+    {
+        /**
+         * @brief Mutex.
+         */
+        MUTEX = 0,
+
+        /**
+         * @brief Semaphore.
+         */
+        SEMAPHORE = 1
+    };
+
+    /**
+     * @struct Counters
+     * @brief Contention counters of one lock.
+     */
+    struct Counters
+    {
+        /**
+         * @brief Address of the lock.
+         */
+        uint64_t lock;
+
+        /**
+         * @brief Type of the lock.
+         */
+        Type type;
+
+        /**
+         * @brief Identifier of the thread which has owned the lock at the last contention, or zero for semaphores.
+         */
+        uint32_t owner;
+
+        /**
+         * @brief Number of acquisitions.
+         */
+        uint64_t acquisitions;
+
+        /**
+         * @brief Number of acquisitions which have waited for the lock.
+         */
+        uint64_t contentions;
+
+        /**
+         * @brief Total time of waiting for the lock in microseconds.
+         */
+        uint64_t waitTime;
+
+        /**
+         * @brief Maximum time of waiting for the lock in microseconds.
+         */
+        uint64_t maxWaitTime;
+
+        /**
+         * @brief Total time of holding the lock in microseconds, which is not measured for semaphores.
+         */
+        uint64_t holdTime;
+    };
+
+    /**
+     * @brief Destructor.
+     */
+    ~LockStatistics() noexcept override = default;
+
+    /**
+     * @brief Tests if statistics are gathered.
+     *
+     * @return True if statistics are gathered.
+     */
+    virtual bool_t isEnabled() const noexcept = 0;
+
+    /**
+     * @brief Returns number of existing locks.
+     *
+     * @return Number of locks.
+     */
+    virtual size_t getNumberOfLocks() const noexcept = 0;
+
+    /**
+     * @brief Copies counters of existing locks.
+     *
+     * @param counters Buffer to copy to.
+     * @param count    Number of counters the buffer can keep.
+     * @return Number of copied counters.
+     */
+    virtual size_t getCounters(Counters* counters, size_t count) const noexcept = 0;
+
+    /**
+     * @brief Prints counters of existing locks which have been contended.
+     *
+     * @param stream Stream to print to.
+     */
+    virtual void dump(api::OutStream<char_t>& stream) const noexcept = 0;
+
+    /**
+     * @brief Resets counters of all locks.
+     */
+    virtual void reset() noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_LOCKSTATISTICS_HPP_
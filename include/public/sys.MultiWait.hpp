@@ -0,0 +1,92 @@
+/**
+ * @file      sys.MultiWait.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_MULTIWAIT_HPP_
+#define SYS_MULTIWAIT_HPP_
+
+#include "api.Object.hpp"
+#include "sys.Waitable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class MultiWait
+ * @brief Interface of waiting for many objects at once.
+ *
+ * Semaphores of the default type, threads and events can be waited for. A semaphore fires
+ * when one of its permits has been acquired, a thread fires when it has terminated, and
+ * an event fires when it is set, and an auto-reset event is reset when it has fired.
+ * Waiting for all the objects takes them only when all of them can fire at once.
+ * Light semaphores count their permits in user space and cannot be waited for,
+ * so a wait given one of them fails at once without taking any object.
+ */
+class MultiWait : public api::Object
+{
+
+public:
+
+    /**
+     * @brief Index returned if no object has fired.
+     */
+    static const int32_t NONE{ -1 };
+
+    /**
+     * @brief Maximum number of objects to wait for.
+     */
+    static const int32_t MAXIMUM_NUMBER{ 63 };
+
+    /**
+     * @brief Destructor.
+     */
+    ~MultiWait() noexcept override = default;
+
+    /**
+     * @brief Waits until one of objects fires.
+     *
+     * @param objects The objects, none of which is a light semaphore.
+     * @param number  Number of the objects up to the maximum.
+     * @return Index of the object which has fired, or NONE if an error has been occurred or an object is a light semaphore.
+     */
+    virtual int32_t waitAny(Waitable* const* objects, int32_t number) noexcept = 0;
+
+    /**
+     * @brief Waits until one of objects fires or the timeout expires.
+     *
+     * If many objects fire, the least index is returned.
+     *
+     * @param objects   The objects, none of which is a light semaphore.
+     * @param number    Number of the objects up to the maximum.
+     * @param timeoutUs Timeout in microseconds.
+     * @return Index of the object which has fired, or NONE if the timeout has expired, an error has been occurred or an object is a light semaphore.
+     */
+    virtual int32_t waitAny(Waitable* const* objects, int32_t number, uint64_t timeoutUs) noexcept = 0;
+
+    /**
+     * @brief Waits until all objects fire.
+     *
+     * @param objects The objects, none of which is a light semaphore.
+     * @param number  Number of the objects up to the maximum.
+     * @return True if all the objects have fired, or false if an error has been occurred or an object is a light semaphore.
+     */
+    virtual bool_t waitAll(Waitable* const* objects, int32_t number) noexcept = 0;
+
+    /**
+     * @brief Waits until all objects fire or the timeout expires.
+     *
+     * @param objects   The objects, none of which is a light semaphore.
+     * @param number    Number of the objects up to the maximum.
+     * @param timeoutUs Timeout in microseconds.
+     * @return True if all the objects have fired, or false if the timeout has expired and no object has been taken, or an object is a light semaphore.
+     */
+    virtual bool_t waitAll(Waitable* const* objects, int32_t number, uint64_t timeoutUs) noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_MULTIWAIT_HPP_
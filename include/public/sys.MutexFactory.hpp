@@ -0,0 +1,94 @@
+/**
+ * @file      sys.MutexFactory.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_MUTEXFACTORY_HPP_
+#define SYS_MUTEXFACTORY_HPP_
+
+#include "api.Object.hpp"
+#include "sys.TimedMutex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class MutexFactory
+ * @brief Factory of mutexes of given types.
+ */
+class MutexFactory : public api::Object
+{
+
+public:
+
+    /**
+     * @enum  Type
+     * @brief Mutex types.
+     */
+    enum class Type : int32_t
+    {
+        /**
+         * @brief Recursive mutex based on a Windows critical section.
+         */
+        DEFAULT = 0,
+
+        /**
+         * @brief Non-recursive pointer-sized mutex which needs no system calls to be created and deleted.
+         */
+        SLIM = 1,
+
+        /**
+         * @brief Non-recursive queue mutex which passes the mutex to waiting threads in the FIFO order.
+         */
+        FAIR = 2
+    };
+
+    /**
+     * @struct SpinPolicy
+     * @brief Spinning policy of a mutex before it waits on the kernel.
+     */
+    struct SpinPolicy
+    {
+        /**
+         * @brief Number of spins, or the maximum number if the policy is adaptive.
+         */
+        uint32_t spinCount;
+
+        /**
+         * @brief Adapt the number of spins to measured contention of the mutex.
+         */
+        bool_t isAdaptive;
+    };
+
+    /**
+     * @brief Destructor.
+     */
+    ~MutexFactory() noexcept override = default;
+
+    /**
+     * @brief Creates a new mutex of a type.
+     *
+     * @param type The mutex type.
+     * @return A new mutex, or NULLPTR if an error has been occurred.
+     */
+    virtual TimedMutex* create(Type type) noexcept = 0;
+
+    /**
+     * @brief Creates a new mutex of a type with a spinning policy.
+     *
+     * The policy is applied to mutexes of the default type, which spin 4000 times if no policy is given,
+     * and the number of spins is applied to fair mutexes.
+     *
+     * @param type   The mutex type.
+     * @param policy The spinning policy.
+     * @return A new mutex, or NULLPTR if an error has been occurred.
+     */
+    virtual TimedMutex* create(Type type, SpinPolicy const& policy) noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_MUTEXFACTORY_HPP_
@@ -0,0 +1,87 @@
+/**
+ * @file      sys.ProcessPriority.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_PROCESSPRIORITY_HPP_
+#define SYS_PROCESSPRIORITY_HPP_
+
+#include "api.Object.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ProcessPriority
+ * @brief Priority class of the process, which is the base of priorities of all its threads.
+ */
+class ProcessPriority : public api::Object
+{
+
+public:
+
+    /**
+     * @brief Threads of the process run only when the system is idle.
+     */
+    static const int32_t CLASS_IDLE{ 0 };
+
+    /**
+     * @brief Priority class between the idle and normal ones.
+     */
+    static const int32_t CLASS_BELOW_NORMAL{ 1 };
+
+    /**
+     * @brief Priority class of a process with no special scheduling needs.
+     */
+    static const int32_t CLASS_NORMAL{ 2 };
+
+    /**
+     * @brief Priority class between the normal and high ones.
+     */
+    static const int32_t CLASS_ABOVE_NORMAL{ 3 };
+
+    /**
+     * @brief Priority class of a process performing time-critical tasks.
+     */
+    static const int32_t CLASS_HIGH{ 4 };
+
+    /**
+     * @brief The highest priority class, which preempts system threads.
+     */
+    static const int32_t CLASS_REALTIME{ 5 };
+
+    /**
+     * @brief Wrong priority class.
+     */
+    static const int32_t CLASS_WRONG{ -1 };
+
+    /**
+     * @brief Destructor.
+     */
+    ~ProcessPriority() noexcept override = default;
+
+    /**
+     * @brief Returns the priority class of the process.
+     *
+     * @return The priority class, or CLASS_WRONG if an error has been occurred.
+     */
+    virtual int32_t getPriorityClass() const noexcept = 0;
+
+    /**
+     * @brief Sets the priority class of the process.
+     *
+     * The realtime class requires the increase base priority privilege, without which
+     * the system sets the high class.
+     *
+     * @param priorityClass The priority class.
+     * @return True if the priority class has been set.
+     */
+    virtual bool_t setPriorityClass(int32_t priorityClass) noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_PROCESSPRIORITY_HPP_
@@ -0,0 +1,79 @@
+/**
+ * @file      sys.RwLock.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RWLOCK_HPP_
+#define SYS_RWLOCK_HPP_
+
+#include "api.Object.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class RwLock
+ * @brief Reader-writer lock interface.
+ *
+ * The lock is held either by many readers in shared mode or by one writer in exclusive mode.
+ * The lock is not recursive, and it must be unlocked by the thread which has locked it.
+ */
+class RwLock : public api::Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~RwLock() noexcept override = default;
+
+    /**
+     * @brief Tries to lock in shared mode.
+     *
+     * @return True if the lock has been locked.
+     */
+    virtual bool_t tryLockShared() noexcept = 0;
+
+    /**
+     * @brief Locks in shared mode.
+     *
+     * @return True if the lock has been locked.
+     */
+    virtual bool_t lockShared() noexcept = 0;
+
+    /**
+     * @brief Unlocks the lock locked in shared mode.
+     *
+     * @return True if the lock has been unlocked.
+     */
+    virtual bool_t unlockShared() noexcept = 0;
+
+    /**
+     * @brief Tries to lock in exclusive mode.
+     *
+     * @return True if the lock has been locked.
+     */
+    virtual bool_t tryLock() noexcept = 0;
+
+    /**
+     * @brief Locks in exclusive mode.
+     *
+     * @return True if the lock has been locked.
+     */
+    virtual bool_t lock() noexcept = 0;
+
+    /**
+     * @brief Unlocks the lock locked in exclusive mode.
+     *
+     * @return True if the lock has been unlocked.
+     */
+    virtual bool_t unlock() noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RWLOCK_HPP_
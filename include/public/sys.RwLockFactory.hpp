@@ -0,0 +1,53 @@
+/**
+ * @file      sys.RwLockFactory.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_RWLOCKFACTORY_HPP_
+#define SYS_RWLOCKFACTORY_HPP_
+
+#include "api.Object.hpp"
+#include "sys.RwLock.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class RwLockFactory
+ * @brief Factory of reader-writer locks.
+ */
+class RwLockFactory : public api::Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~RwLockFactory() noexcept override = default;
+
+    /**
+     * @brief Creates a new reader-writer lock.
+     *
+     * @return A new lock, or NULLPTR if an error has been occurred.
+     */
+    virtual RwLock* create() noexcept = 0;
+
+    /**
+     * @brief Creates a new reader-writer lock with a preference of writers.
+     *
+     * A lock which prefers writers does not let new readers in while a writer is waiting for the lock,
+     * thus writers are not starved by a steady flow of readers.
+     *
+     * @param isWriterPreferred Prefer writers to readers.
+     * @return A new lock, or NULLPTR if an error has been occurred.
+     */
+    virtual RwLock* create(bool_t isWriterPreferred) noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_RWLOCKFACTORY_HPP_
@@ -0,0 +1,81 @@
+/**
+ * @file      sys.SemaphoreFactory.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_SEMAPHOREFACTORY_HPP_
+#define SYS_SEMAPHOREFACTORY_HPP_
+
+#include "api.Object.hpp"
+#include "sys.CountingSemaphore.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class SemaphoreFactory
+ * @brief Factory of semaphores of given types.
+ */
+class SemaphoreFactory : public api::Object
+{
+
+public:
+
+    /**
+     * @enum  Type
+     * @brief Semaphore types.
+     */
+    enum class Type : int32_t
+    {
+        /**
+         * @brief Semaphore based on a Windows semaphore, which calls the kernel on each operation.
+         *
+         * A Windows semaphore gives one permit per wait, so acquiring many permits
+         * at once costs a kernel call per permit.
+         */
+        DEFAULT = 0,
+
+        /**
+         * @brief Semaphore which calls the kernel only if a thread has to block or to be woken up.
+         *
+         * Permits are counted in user space, so many permits are acquired at once by one
+         * interlocked operation, and a blocked thread waits only for the missing permits.
+         * Thus, the semaphore has no kernel object to wait on, and MultiWait fails
+         * at once for any set of objects including a light semaphore.
+         */
+        LIGHT = 1
+    };
+
+    /**
+     * @brief Destructor.
+     */
+    ~SemaphoreFactory() noexcept override = default;
+
+    /**
+     * @brief Creates a new semaphore of a type.
+     *
+     * @param permits The initial number of permits available.
+     * @param type    The semaphore type.
+     * @return A new semaphore, or NULLPTR if an error has been occurred.
+     */
+    virtual CountingSemaphore* create(int32_t permits, Type type) noexcept = 0;
+
+    /**
+     * @brief Creates a new semaphore of a type which spins before blocking.
+     *
+     * The spin count is applied to lightweight semaphores.
+     *
+     * @param permits   The initial number of permits available.
+     * @param type      The semaphore type.
+     * @param spinCount Number of spins waiting for a permit before blocking.
+     * @return A new semaphore, or NULLPTR if an error has been occurred.
+     */
+    virtual CountingSemaphore* create(int32_t permits, Type type, uint32_t spinCount) noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_SEMAPHOREFACTORY_HPP_
@@ -0,0 +1,55 @@
+/**
+ * @file      sys.ThreadFactory.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_THREADFACTORY_HPP_
+#define SYS_THREADFACTORY_HPP_
+
+#include "api.Object.hpp"
+#include "api.Task.hpp"
+#include "sys.AffineThread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class ThreadFactory
+ * @brief Factory of threads.
+ */
+class ThreadFactory : public api::Object
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~ThreadFactory() noexcept override = default;
+
+    /**
+     * @brief Creates a new thread.
+     *
+     * @param task A task interface whose main function is invoked when the thread is started.
+     * @return A new thread, or NULLPTR if an error has been occurred.
+     */
+    virtual AffineThread* create(api::Task& task) noexcept = 0; ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+
+    /**
+     * @brief Creates a new thread on processors of a NUMA node.
+     *
+     * The thread is placed before it is executed, so its stack is on the node.
+     *
+     * @param task A task interface whose main function is invoked when the thread is started.
+     * @param node Number of the node, or NODE_ANY.
+     * @return A new thread, or NULLPTR if an error has been occurred.
+     */
+    virtual AffineThread* create(api::Task& task, int32_t node) noexcept = 0; ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_THREADFACTORY_HPP_
@@ -0,0 +1,54 @@
+/**
+ * @file      sys.TimedMutex.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TIMEDMUTEX_HPP_
+#define SYS_TIMEDMUTEX_HPP_
+
+#include "api.Mutex.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class TimedMutex
+ * @brief Mutex interface waiting with timeouts.
+ */
+class TimedMutex : public api::Mutex
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~TimedMutex() noexcept override = default;
+
+    /**
+     * @brief Locks the mutex waiting until it is unlocked or the timeout expires.
+     *
+     * @param timeoutUs Timeout in microseconds.
+     * @return True if the mutex has been locked.
+     */
+    virtual bool_t lock(uint64_t timeoutUs) noexcept = 0;
+
+    /**
+     * @brief Tests if the calling thread has locked the mutex more than once.
+     *
+     * A condition variable unlocks the mutex once, thus it refuses to wait
+     * with a mutex locked recursively, which would stay locked while the thread sleeps.
+     *
+     * @return True if the mutex is locked recursively by the calling thread.
+     */
+    virtual bool_t isLockedRecursively() const noexcept = 0;
+
+    using api::Mutex::lock;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TIMEDMUTEX_HPP_
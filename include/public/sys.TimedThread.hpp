@@ -0,0 +1,47 @@
+/**
+ * @file      sys.TimedThread.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TIMEDTHREAD_HPP_
+#define SYS_TIMEDTHREAD_HPP_
+
+#include "api.Thread.hpp"
+#include "sys.Waitable.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class TimedThread
+ * @brief Thread interface joining with timeouts.
+ */
+class TimedThread : public api::Thread, public Waitable
+{
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    ~TimedThread() noexcept override = default;
+
+    /**
+     * @brief Waits until the thread terminates or the timeout expires.
+     *
+     * The thread stays joinable if the timeout has expired.
+     *
+     * @param timeoutUs Timeout in microseconds.
+     * @return True if the thread has terminated.
+     */
+    virtual bool_t join(uint64_t timeoutUs) noexcept = 0;
+
+    using api::Thread::join;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TIMEDTHREAD_HPP_
@@ -0,0 +1,218 @@
+/**
+ * @file      sys.Topology.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_TOPOLOGY_HPP_
+#define SYS_TOPOLOGY_HPP_
+
+#include "api.Object.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Topology
+ * @brief Topology of processors of the system.
+ *
+ * Logical processors are indexed in the order of their cores, so SMT siblings have
+ * adjacent indexes. A set of processors is given by a processor group and a mask of processors
+ * in the group, which can be passed to AffineThread::setAffinity().
+ */
+class Topology : public api::Object
+{
+
+public:
+
+    /**
+     * @brief The cache holds instructions and data.
+     */
+    static const int32_t CACHE_UNIFIED{ 0 };
+
+    /**
+     * @brief The cache holds instructions.
+     */
+    static const int32_t CACHE_INSTRUCTION{ 1 };
+
+    /**
+     * @brief The cache holds data.
+     */
+    static const int32_t CACHE_DATA{ 2 };
+
+    /**
+     * @brief The cache holds traces of decoded instructions.
+     */
+    static const int32_t CACHE_TRACE{ 3 };
+
+    /**
+     * @struct Processor
+     * @brief Logical processor.
+     */
+    struct Processor
+    {
+        /**
+         * @brief Processor group of the processor.
+         */
+        uint16_t group;
+
+        /**
+         * @brief Number of the processor in its group.
+         */
+        uint8_t number;
+
+        /**
+         * @brief Index of the core, which is shared by SMT siblings.
+         */
+        int32_t core;
+
+        /**
+         * @brief Index of the package, or -1 if it is unknown.
+         */
+        int32_t package;
+
+        /**
+         * @brief Number of the NUMA node, or -1 if it is unknown.
+         */
+        int32_t node;
+    };
+
+    /**
+     * @struct Cache
+     * @brief Processor cache.
+     */
+    struct Cache
+    {
+        /**
+         * @brief Level of the cache from 1.
+         */
+        int32_t level;
+
+        /**
+         * @brief Type of the cache.
+         */
+        int32_t type;
+
+        /**
+         * @brief Size of the cache in bytes.
+         */
+        size_t size;
+
+        /**
+         * @brief Size of a cache line in bytes.
+         */
+        size_t lineSize;
+
+        /**
+         * @brief Processor group of the processors sharing the cache.
+         */
+        uint16_t group;
+
+        /**
+         * @brief Mask of the processors sharing the cache.
+         */
+        uint64_t mask;
+    };
+
+    /**
+     * @brief Destructor.
+     */
+    ~Topology() noexcept override = default;
+
+    /**
+     * @brief Returns the number of logical processors.
+     *
+     * @return The number of processors.
+     */
+    virtual int32_t getNumberOfProcessors() const noexcept = 0;
+
+    /**
+     * @brief Returns the number of physical cores.
+     *
+     * @return The number of cores.
+     */
+    virtual int32_t getNumberOfCores() const noexcept = 0;
+
+    /**
+     * @brief Returns the number of processor packages.
+     *
+     * @return The number of packages.
+     */
+    virtual int32_t getNumberOfPackages() const noexcept = 0;
+
+    /**
+     * @brief Returns the number of NUMA nodes.
+     *
+     * @return The number of nodes.
+     */
+    virtual int32_t getNumberOfNodes() const noexcept = 0;
+
+    /**
+     * @brief Returns the number of caches of all levels.
+     *
+     * @return The number of caches.
+     */
+    virtual int32_t getNumberOfCaches() const noexcept = 0;
+
+    /**
+     * @brief Returns a logical processor.
+     *
+     * @param index     Index of the processor.
+     * @param processor The processor to fill.
+     * @return True if the index is valid.
+     */
+    virtual bool_t getProcessor(int32_t index, Processor& processor) const noexcept = 0;
+
+    /**
+     * @brief Returns a cache.
+     *
+     * @param index Index of the cache.
+     * @param cache The cache to fill.
+     * @return True if the index is valid.
+     */
+    virtual bool_t getCache(int32_t index, Cache& cache) const noexcept = 0;
+
+    /**
+     * @brief Returns the size of a data or unified cache of a level.
+     *
+     * @param level Level of the cache.
+     * @return Size of the cache in bytes, or zero if there is no such a cache.
+     */
+    virtual size_t getCacheSize(int32_t level) const noexcept = 0;
+
+    /**
+     * @brief Returns the processors of a core, which are SMT siblings.
+     *
+     * @param core  Index of the core.
+     * @param group Processor group of the processors.
+     * @param mask  Mask of the processors.
+     * @return True if the index is valid.
+     */
+    virtual bool_t getCoreAffinity(int32_t core, uint16_t& group, uint64_t& mask) const noexcept = 0;
+
+    /**
+     * @brief Returns the processors of a package in its first processor group.
+     *
+     * @param package Index of the package.
+     * @param group   Processor group of the processors.
+     * @param mask    Mask of the processors.
+     * @return True if the index is valid.
+     */
+    virtual bool_t getPackageAffinity(int32_t package, uint16_t& group, uint64_t& mask) const noexcept = 0;
+
+    /**
+     * @brief Returns the processors of a NUMA node.
+     *
+     * @param node  Number of the node.
+     * @param group Processor group of the processors.
+     * @param mask  Mask of the processors.
+     * @return True if the node exists.
+     */
+    virtual bool_t getNodeAffinity(int32_t node, uint16_t& group, uint64_t& mask) const noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_TOPOLOGY_HPP_
@@ -0,0 +1,47 @@
+/**
+ * @file      sys.Waitable.hpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#ifndef SYS_WAITABLE_HPP_
+#define SYS_WAITABLE_HPP_
+
+#include "api.Object.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @class Waitable
+ * @brief Interface of objects which can be waited for together with other objects.
+ *
+ * The interface is not derived from the object interface to not make its functions ambiguous
+ * in interfaces which are also derived from other object interfaces.
+ */
+class Waitable
+{
+    friend class MultiWaiter;
+
+public:
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~Waitable() noexcept = default;
+
+protected:
+
+    /**
+     * @brief Returns the kernel object which is signaled when the object fires.
+     *
+     * @return The kernel object, or NULLPTR if the object cannot be waited for with other objects.
+     */
+    virtual void* getWaitHandle() noexcept = 0;
+
+};
+
+} // namespace sys
+} // namespace eoos
+#endif // SYS_WAITABLE_HPP_
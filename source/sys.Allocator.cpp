@@ -5,6 +5,7 @@
  */
 #include "sys.Allocator.hpp"
 #include "sys.Call.hpp"
+#include "sys.System.hpp"
 
 namespace eoos
 {
@@ -16,6 +17,11 @@ void* Allocator::allocate(size_t size)
     return sys::Call::get().getHeap().allocate(size, NULLPTR);
 }
 
+void* Allocator::allocate(size_t size, size_t alignment)
+{
+    return System::getSystem().getHeap().allocateAligned(size, alignment);
+}
+
 void Allocator::free(void* ptr)
 {
     return sys::Call::get().getHeap().free(ptr);    
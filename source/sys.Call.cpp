@@ -16,5 +16,70 @@ api::System& Call::get() noexcept
     return System::getSystem();
 }
 
+HeapStatistics& Call::getHeapStatistics() noexcept
+{
+    return System::getSystem().getHeapStatistics();
+}
+
+HeapTrace& Call::getHeapTrace() noexcept
+{
+    return System::getSystem().getHeapTrace();
+}
+
+HeapBenchmark& Call::getHeapBenchmark() noexcept
+{
+    return System::getSystem().getHeapBenchmark();
+}
+
+MutexFactory& Call::getMutexFactory() noexcept
+{
+    return System::getSystem().getMutexManager();
+}
+
+RwLockFactory& Call::getRwLockFactory() noexcept
+{
+    return System::getSystem().getRwLockManager();
+}
+
+SemaphoreFactory& Call::getSemaphoreFactory() noexcept
+{
+    return System::getSystem().getSemaphoreManager();
+}
+
+ThreadFactory& Call::getThreadFactory() noexcept
+{
+    return System::getSystem().getScheduler();
+}
+
+Executor& Call::getExecutor() noexcept
+{
+    return System::getSystem().getScheduler().getExecutor();
+}
+
+ProcessPriority& Call::getProcessPriority() noexcept
+{
+    return System::getSystem().getScheduler();
+}
+
+Topology& Call::getTopology() noexcept
+{
+    return System::getSystem().getScheduler().getTopology();
+}
+
+ConditionFactory& Call::getConditionFactory() noexcept
+{
+    return System::getSystem().getConditionManager();
+}
+
+MultiWait& Call::getMultiWait() noexcept
+{
+    return System::getSystem().getMultiWaiter();
+}
+
+LockStatistics& Call::getLockStatistics() noexcept
+{
+    return System::getSystem().getLockStatistics();
+}
+
 } // namespace sys
 } // namespace eoos
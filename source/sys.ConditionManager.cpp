@@ -0,0 +1,117 @@
+/**
+ * @file      sys.ConditionManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ConditionManager.hpp"
+#include "sys.ConditionVariableSlim.hpp"
+#include "sys.EventKernel.hpp"
+#include "sys.ResourcePool.hpp"
+#include "lib.UniquePointer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+struct ConditionManager::Pool
+{
+    /**
+     * @brief Memory of condition variables.
+     */
+    ResourcePool<sizeof(ConditionVariableSlim<ConditionManager>), EOOS_GLOBAL_SYS_NUMBER_OF_CONDITION_VARIABLES> conditionVariables;
+
+    /**
+     * @brief Memory of events.
+     */
+    ResourcePool<sizeof(EventKernel<ConditionManager>), EOOS_GLOBAL_SYS_NUMBER_OF_EVENTS> events;
+};
+
+ConditionManager::Pool ConditionManager::pool_{};
+
+ConditionManager::ConditionManager() noexcept 
+    : NonCopyable<NoAllocator>()
+    , ConditionFactory() {
+    setConstructed( true );
+}
+
+bool_t ConditionManager::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}    
+
+ConditionVariable* ConditionManager::createConditionVariable() noexcept try
+{
+    lib::UniquePointer<ConditionVariable> res;
+    if( isConstructed() )
+    {   
+        res.reset( new ConditionVariableSlim<ConditionManager>() ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {   ///< UT Justified Branch: HW dependency
+                res.reset();
+            }
+        }
+    }
+    return res.release();
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return NULLPTR;
+}
+
+Event* ConditionManager::createEvent(bool_t isManualReset, bool_t isSet) noexcept try
+{
+    lib::UniquePointer<Event> res;
+    if( isConstructed() )
+    {   
+        res.reset( new EventKernel<ConditionManager>(isManualReset, isSet) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {   ///< UT Justified Branch: OS dependency
+                res.reset();
+            }
+        }
+    }
+    return res.release();
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return NULLPTR;
+}
+
+void* ConditionManager::allocate(size_t size)
+{
+    // Events are taken from their own pool to not waste bigger slots
+    void* addr{ NULLPTR };
+    if( size <= sizeof(EventKernel<ConditionManager>) )
+    {
+        addr = pool_.events.allocate(size);
+    }
+    if(addr == NULLPTR)
+    {
+        addr = pool_.conditionVariables.allocate(size);
+    }
+    if(addr == NULLPTR)
+    {
+        addr = Allocator::allocate(size);
+    }
+    return addr;
+}
+
+void ConditionManager::free(void* ptr)
+{
+    if( pool_.events.isOwned(ptr) )
+    {
+        pool_.events.free(ptr);
+    }
+    else if( pool_.conditionVariables.isOwned(ptr) )
+    {
+        pool_.conditionVariables.free(ptr);
+    }
+    else
+    {
+        Allocator::free(ptr);
+    }
+}
+
+} // namespace sys
+} // namespace eoos
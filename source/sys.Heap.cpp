@@ -4,12 +4,17 @@
  * @copyright 2022-2023, Sergey Baigudin, Baigudin Software
  */
 #include "sys.Heap.hpp"
+#include "lib.Memory.hpp"
 
 namespace eoos
 {
 namespace sys
 {
 
+#ifdef EOOS_GLOBAL_ENABLE_NO_HEAP
+ucell_t Heap::memory_[EOOS_GLOBAL_SYS_HEAP_ARENA_SIZE];
+#endif // EOOS_GLOBAL_ENABLE_NO_HEAP
+
 Heap::Heap() noexcept 
     : api::Heap() {
 }
@@ -21,25 +26,238 @@ bool_t Heap::isConstructed() const noexcept
 
 void* Heap::allocate(size_t const size, void* ptr) noexcept try
 {    
-    static_cast<void>(ptr); // Avoid MISRA-C++:2008 Rule 0–1–3 and AUTOSAR C++14 Rule A0-1-4
-    #ifndef EOOS_GLOBAL_ENABLE_NO_HEAP
-    return new ucell_t[size];
-    #else
-    static_cast<void>(size); // Avoid MISRA-C++:2008 Rule 0–1–3 and AUTOSAR C++14 Rule A0-1-4
-    return NULLPTR;
-    #endif // EOOS_GLOBAL_ENABLE_NO_HEAP
+    void* addr{ NULLPTR };
+    if(ptr == NULLPTR)
+    {
+        addr = allocateBlock(size);
+    }
+    else if(size == 0U)
+    {
+        free(ptr);
+    }
+    else if( resizeBlock(ptr, size) )
+    {
+        addr = ptr;
+    }
+    else
+    {
+        addr = allocateBlock(size);
+        if(addr != NULLPTR)
+        {
+            size_t const oldSize{ getUsableSize(ptr) };
+            size_t const copySize{ (oldSize < size) ? oldSize : size };
+            static_cast<void>( lib::Memory::memcpy(addr, ptr, copySize) );
+            free(ptr);
+        }
+    }
+    return addr;
 } catch (...) { ///< UT Justified Branch: OS dependency
     return NULLPTR;
 }
 
+void* Heap::allocateAligned(size_t size, size_t alignment) noexcept
+{
+    void* addr{ NULLPTR };
+    bool_t const isAlignment{ (alignment != 0U) && ((alignment & (alignment - 1U)) == 0U) };
+    if(isAlignment == false)
+    {
+        // Alignment must be a power of two
+    }
+    else if(alignment <= DEFAULT_ALIGNMENT)
+    {
+        addr = allocateBlock(size);
+    }
+    else
+    {
+        #ifndef EOOS_GLOBAL_ENABLE_NO_HEAP
+        // Slab blocks are aligned to their class size up to the slab header size
+        size_t const blockSize{ (size > alignment) ? size : alignment };
+        if( (alignment <= HeapSlab::MAX_ALIGNMENT) && (blockSize <= HeapSlab::MAX_BLOCK_SIZE) )
+        {
+            addr = slab_.allocate(blockSize);
+        }
+        if(addr == NULLPTR)
+        {
+            addr = large_.allocate(size, alignment);
+        }
+        #else
+        addr = arena_.allocate(size, alignment);
+        #endif // EOOS_GLOBAL_ENABLE_NO_HEAP
+        recordAllocation(addr, size);
+    }
+    return addr;
+}
+
 void Heap::free(void* ptr) noexcept
 {
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
+    if(ptr != NULLPTR)
+    {
+        monitor_.recordFree( getUsableSize(ptr) );
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE
+    if(ptr != NULLPTR)
+    {
+        tracer_.recordFree(ptr);
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE
+    #ifndef EOOS_GLOBAL_ENABLE_NO_HEAP
+    if( slab_.isOwned(ptr) )
+    {
+        slab_.free(ptr);
+    }
+    else if( large_.isOwned(ptr) )
+    {
+        large_.free(ptr);
+    }
+    else if(ptr != NULLPTR)
+    {
+        static_cast<void>( ::HeapFree(heap_, 0U, ptr) );
+    }
+    else
+    {
+        // Nothing to free
+    }
+    #else
+    arena_.free(ptr);
+    #endif // EOOS_GLOBAL_ENABLE_NO_HEAP
+}
+
+size_t Heap::getUsableSize(void const* ptr) const noexcept
+{
+    size_t size{ 0U };
+    #ifndef EOOS_GLOBAL_ENABLE_NO_HEAP
+    if( slab_.isOwned(ptr) )
+    {
+        size = slab_.getSize(ptr);
+    }
+    else if( large_.isOwned(ptr) )
+    {
+        size = large_.getSize(ptr);
+    }
+    else if(ptr != NULLPTR)
+    {
+        ::SIZE_T const heapSize{ ::HeapSize(heap_, 0U, ptr) };
+        if(heapSize != static_cast< ::SIZE_T >(-1))
+        {
+            size = static_cast<size_t>(heapSize);
+        }
+    }
+    else
+    {
+        // Null pointer has no size
+    }
+    #else
+    size = arena_.getSize(ptr);
+    #endif // EOOS_GLOBAL_ENABLE_NO_HEAP
+    return size;
+}
+
+HeapStatistics& Heap::getStatistics() noexcept
+{
+    return monitor_;
+}
+
+HeapTrace& Heap::getTrace() noexcept
+{
+    return tracer_;
+}
+
+#ifdef EOOS_GLOBAL_ENABLE_NO_HEAP
+
+HeapArena& Heap::getArena() noexcept
+{
+    return arena_;
+}
+
+#endif // EOOS_GLOBAL_ENABLE_NO_HEAP
+
+void* Heap::allocateBlock(size_t size) noexcept
+{
+    #ifndef EOOS_GLOBAL_ENABLE_NO_HEAP
+    void* addr{ NULLPTR };
+    if(size >= EOOS_GLOBAL_SYS_HEAP_LARGE_BLOCK_SIZE)
+    {
+        addr = large_.allocate(size);
+    }
+    else
+    {
+        addr = slab_.allocate(size);
+    }
+    if( (addr == NULLPTR) && (heap_ != NULLPTR) )
+    {
+        addr = ::HeapAlloc(heap_, 0U, size);
+    }
+    #else
+    void* addr{ arena_.allocate(size) };
+    #endif // EOOS_GLOBAL_ENABLE_NO_HEAP
+    recordAllocation(addr, size);
+    return addr;
+}
+
+void Heap::recordAllocation(void* addr, size_t size) noexcept
+{
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
+    if(addr != NULLPTR)
+    {
+        monitor_.recordAllocation(size, getUsableSize(addr));
+    }
+    else
+    {
+        monitor_.recordFailure();
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE
+    if(addr != NULLPTR)
+    {
+        tracer_.recordAllocation(addr, size);
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE
+    // The arguments are unused if neither statistics nor trace is enabled
+    static_cast<void>(addr);
+    static_cast<void>(size);
+}
+
+bool_t Heap::resizeBlock(void* ptr, size_t size) noexcept
+{
+    bool_t res{ false };
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
+    size_t const oldUsable{ getUsableSize(ptr) };
+    #endif // EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
     #ifndef EOOS_GLOBAL_ENABLE_NO_HEAP
-    ucell_t* addr{ static_cast<ucell_t*>(ptr) }; ///< SCA AUTOSAR-C++14 Justified Rule M5-2-8
-    delete[] addr;
+    if( slab_.isOwned(ptr) )
+    {
+        // A slab block cannot change its size class, but the whole class size is usable
+        res = size <= slab_.getSize(ptr);
+    }
+    else if( large_.isOwned(ptr) )
+    {
+        res = large_.resize(ptr, size);
+    }
+    else
+    {
+        ::LPVOID const addr{ ::HeapReAlloc(heap_, HEAP_REALLOC_IN_PLACE_ONLY, ptr, size) };
+        res = addr != NULL;
+    }
     #else
-    static_cast<void>(ptr); // Avoid MISRA-C++:2008 Rule 0–1–3 and AUTOSAR C++14 Rule A0-1-4
+    res = arena_.resize(ptr, size);
     #endif // EOOS_GLOBAL_ENABLE_NO_HEAP
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
+    if(res == true)
+    {
+        monitor_.recordResize(oldUsable, getUsableSize(ptr));
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE
+    if(res == true)
+    {
+        // A block resized in place is replayed as freed and allocated again
+        tracer_.recordFree(ptr);
+        tracer_.recordAllocation(ptr, size);
+    }
+    #endif // EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE
+    return res;
 }
     
 } // namespace sys
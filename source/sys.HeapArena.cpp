@@ -0,0 +1,176 @@
+/**
+ * @file      sys.HeapArena.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.HeapArena.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+HeapArena::Scope::Scope(HeapArena& arena) noexcept
+    : NonCopyable<NoAllocator>()
+    , arena_( arena )
+    , mark_( arena.getMark() ) {
+}
+
+HeapArena::Scope::~Scope() noexcept
+{
+    static_cast<void>( arena_.rewind(mark_) );
+}
+
+HeapArena::HeapArena(void* memory, size_t size) noexcept
+    : NonCopyable<NoAllocator>()
+    , memory_( static_cast<ucell_t*>(memory) )
+    , size_( size ) {
+    ::InitializeSRWLock(&lock_);
+    bool_t const isConstructed{ memory_ != NULLPTR };
+    setConstructed( isConstructed );
+}
+
+bool_t HeapArena::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+void* HeapArena::allocate(size_t size) noexcept
+{
+    return allocate(size, ALIGNMENT);
+}
+
+void* HeapArena::allocate(size_t size, size_t alignment) noexcept
+{
+    void* addr{ NULLPTR };
+    bool_t const isAlignment{ (alignment != 0U) && ((alignment & (alignment - 1U)) == 0U) && (alignment <= size_) };
+    if( isConstructed() && isAlignment )
+    {
+        size_t const align{ (alignment > ALIGNMENT) ? alignment : ALIGNMENT };
+        size_t const blockSize{ (size + (ALIGNMENT - 1U)) & ~(ALIGNMENT - 1U) };
+        ::AcquireSRWLockExclusive(&lock_);
+        // The memory is aligned to 16 bytes, so the padding before an aligned block is multiple of 16 bytes
+        size_t const padding{ (align - ((offset_ + HEADER_SIZE) & (align - 1U))) & (align - 1U) };
+        // Check each term separately to avoid an overflow of the sum
+        if( (blockSize >= size) && (blockSize <= size_) && (HEADER_SIZE <= (size_ - blockSize))
+         && (padding <= (size_ - blockSize - HEADER_SIZE))
+         && (offset_ <= (size_ - blockSize - HEADER_SIZE - padding)) )
+        {
+            size_t const begin{ offset_ + padding };
+            Header* const header{ reinterpret_cast<Header*>(&memory_[begin]) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+            header->size = blockSize;
+            header->begin = offset_;
+            addr = &memory_[begin + HEADER_SIZE];
+            offset_ = begin + HEADER_SIZE + blockSize;
+        }
+        ::ReleaseSRWLockExclusive(&lock_);
+    }
+    return addr;
+}
+
+void HeapArena::free(void* ptr) noexcept
+{
+    if( isOwned(ptr) )
+    {
+        ucell_t* const block{ static_cast<ucell_t*>(ptr) }; ///< SCA AUTOSAR-C++14 Justified Rule M5-2-8
+        Header const* const header{ reinterpret_cast<Header*>(block - HEADER_SIZE) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        ::AcquireSRWLockExclusive(&lock_);
+        if( (block + header->size) == &memory_[offset_] )
+        {
+            // Give back the padding before the block too
+            offset_ = header->begin;
+        }
+        ::ReleaseSRWLockExclusive(&lock_);
+    }
+}
+
+bool_t HeapArena::isOwned(void const* ptr) const noexcept
+{
+    bool_t res{ false };
+    if( (ptr != NULLPTR) && isConstructed() )
+    {
+        ::ULONG_PTR const addr{ reinterpret_cast< ::ULONG_PTR >(ptr) };       ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        ::ULONG_PTR const begin{ reinterpret_cast< ::ULONG_PTR >(memory_) };  ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        res = (addr >= (begin + HEADER_SIZE)) && (addr < (begin + size_));
+    }
+    return res;
+}
+
+size_t HeapArena::getSize(void const* ptr) const noexcept
+{
+    size_t size{ 0U };
+    if( isOwned(ptr) )
+    {
+        ucell_t const* const block{ static_cast<ucell_t const*>(ptr) }; ///< SCA AUTOSAR-C++14 Justified Rule M5-2-8
+        size = reinterpret_cast<Header const*>(block - HEADER_SIZE)->size; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+    }
+    return size;
+}
+
+bool_t HeapArena::resize(void* ptr, size_t size) noexcept
+{
+    bool_t res{ false };
+    if( isOwned(ptr) )
+    {
+        ucell_t* const block{ static_cast<ucell_t*>(ptr) }; ///< SCA AUTOSAR-C++14 Justified Rule M5-2-8
+        Header* const header{ reinterpret_cast<Header*>(block - HEADER_SIZE) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        size_t const blockSize{ (size + (ALIGNMENT - 1U)) & ~(ALIGNMENT - 1U) };
+        size_t const begin{ static_cast<size_t>(block - memory_) };
+        ::AcquireSRWLockExclusive(&lock_);
+        bool_t const isLast{ (begin + header->size) == offset_ };
+        if( blockSize < size )
+        {
+            // The size is too big to be aligned
+        }
+        else if( blockSize <= header->size )
+        {
+            if(isLast)
+            {
+                offset_ = begin + blockSize;
+                header->size = blockSize;
+            }
+            res = true;
+        }
+        else if( isLast && (blockSize <= (size_ - begin)) )
+        {
+            offset_ = begin + blockSize;
+            header->size = blockSize;
+            res = true;
+        }
+        else
+        {
+            // The block cannot be grown in place
+        }
+        ::ReleaseSRWLockExclusive(&lock_);
+    }
+    return res;
+}
+
+size_t HeapArena::getMark() const noexcept
+{
+    return offset_;
+}
+
+bool_t HeapArena::rewind(size_t mark) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::AcquireSRWLockExclusive(&lock_);
+        if(mark <= offset_)
+        {
+            offset_ = mark;
+            res = true;
+        }
+        ::ReleaseSRWLockExclusive(&lock_);
+    }
+    return res;
+}
+
+void HeapArena::reset() noexcept
+{
+    static_cast<void>( rewind(0U) );
+}
+
+} // namespace sys
+} // namespace eoos
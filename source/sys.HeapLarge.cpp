@@ -0,0 +1,291 @@
+/**
+ * @file      sys.HeapLarge.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.HeapLarge.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+HeapLarge::HeapLarge() noexcept
+    : NonCopyable<NoAllocator>() {
+    for(size_t i{0U}; i<NUMBER_OF_BUCKETS; i++)
+    {
+        buckets_[i] = NULLPTR;
+    }
+    ::InitializeSRWLock(&lock_);
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+HeapLarge::~HeapLarge() noexcept
+{
+    for(size_t i{0U}; i<NUMBER_OF_BUCKETS; i++)
+    {
+        while(buckets_[i] != NULLPTR)
+        {
+            Block* const block{ buckets_[i] };
+            buckets_[i] = block->next;
+            static_cast<void>( ::VirtualFree(block, 0U, MEM_RELEASE) );
+        }
+    }
+}
+
+bool_t HeapLarge::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+void* HeapLarge::allocate(size_t size) noexcept
+{
+    return allocate(size, HEADER_SIZE);
+}
+
+void* HeapLarge::allocate(size_t size, size_t alignment) noexcept
+{
+    void* addr{ NULLPTR };
+    // Memory given to user is placed after the header at the alignment boundary
+    size_t const offset{ (alignment > HEADER_SIZE) ? alignment : HEADER_SIZE };
+    size_t const total{ size + offset };
+    bool_t const isAlignment{ (alignment != 0U) && ((alignment & (alignment - 1U)) == 0U) && (alignment < granularity_) };
+    if( isConstructed() && isAlignment && (total > size) )
+    {
+        Block* block{ NULLPTR };
+        if( (largePageSize_ != 0U) && (total >= largePageSize_) )
+        {
+            // Large pages cannot be committed on demand, thus the whole reservation is committed at once
+            size_t const reserved{ roundUp(total, largePageSize_) };
+            ::LPVOID const memory{ (reserved == 0U) ? NULL : ::VirtualAlloc(NULL, reserved, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE) };
+            if(memory != NULL)
+            {
+                block = static_cast<Block*>(memory);
+                block->reserved = reserved;
+                block->committed = reserved;
+                block->isLargePage = true;
+            }
+        }
+        size_t const committed{ roundUp(total, pageSize_) };
+        size_t const reserved{ roundUp(committed, granularity_) };
+        if( (block == NULLPTR) && (reserved != 0U) )
+        {
+            size_t extended{ reserved * RESERVE_FACTOR };
+            if( (extended / RESERVE_FACTOR) != reserved )
+            {
+                extended = reserved;
+            }
+            ::LPVOID memory{ ::VirtualAlloc(NULL, extended, MEM_RESERVE, PAGE_READWRITE) };
+            if( (memory == NULL) && (extended != reserved) )
+            {
+                extended = reserved;
+                memory = ::VirtualAlloc(NULL, extended, MEM_RESERVE, PAGE_READWRITE);
+            }
+            if(memory != NULL)
+            {
+                if( ::VirtualAlloc(memory, committed, MEM_COMMIT, PAGE_READWRITE) != NULL )
+                {
+                    block = static_cast<Block*>(memory);
+                    block->reserved = extended;
+                    block->committed = committed;
+                    block->isLargePage = false;
+                }
+                else
+                {
+                    static_cast<void>( ::VirtualFree(memory, 0U, MEM_RELEASE) );
+                }
+            }
+        }
+        if(block != NULLPTR)
+        {
+            block->offset = offset;
+            size_t const bucket{ getBucket(block) };
+            ::AcquireSRWLockExclusive(&lock_);
+            block->next = buckets_[bucket];
+            buckets_[bucket] = block;
+            ::ReleaseSRWLockExclusive(&lock_);
+            addr = reinterpret_cast<ucell_t*>(block) + offset; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        }
+    }
+    return addr;
+}
+
+void HeapLarge::free(void* ptr) noexcept
+{
+    Block* const block{ findBlock(ptr) };
+    if(block != NULLPTR)
+    {
+        size_t const bucket{ getBucket(block) };
+        ::AcquireSRWLockExclusive(&lock_);
+        Block** it{ &buckets_[bucket] };
+        while( (*it != NULLPTR) && (*it != block) )
+        {
+            it = &(*it)->next;
+        }
+        if(*it == block)
+        {
+            *it = block->next;
+        }
+        ::ReleaseSRWLockExclusive(&lock_);
+        static_cast<void>( ::VirtualFree(block, 0U, MEM_RELEASE) );
+    }
+}
+
+bool_t HeapLarge::isOwned(void const* ptr) const noexcept
+{
+    return findBlock(ptr) != NULLPTR;
+}
+
+size_t HeapLarge::getSize(void const* ptr) const noexcept
+{
+    size_t size{ 0U };
+    Block const* const block{ findBlock(ptr) };
+    if(block != NULLPTR)
+    {
+        size = block->committed - block->offset;
+    }
+    return size;
+}
+
+bool_t HeapLarge::resize(void* ptr, size_t size) noexcept
+{
+    bool_t res{ false };
+    Block* const block{ findBlock(ptr) };
+    if(block != NULLPTR)
+    {
+        size_t const total{ size + block->offset };
+        if(total < size)
+        {
+            // The size is too big
+        }
+        else if(block->isLargePage)
+        {
+            res = total <= block->committed;
+        }
+        else
+        {
+            size_t const committed{ roundUp(total, pageSize_) };
+            ucell_t* const memory{ reinterpret_cast<ucell_t*>(block) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+            if( (committed == 0U) || (committed > block->reserved) )
+            {
+                // The block cannot be grown over its reservation
+            }
+            else if(committed > block->committed)
+            {
+                ::LPVOID const tail{ ::VirtualAlloc(&memory[block->committed], committed - block->committed, MEM_COMMIT, PAGE_READWRITE) };
+                if(tail != NULL)
+                {
+                    block->committed = committed;
+                    res = true;
+                }
+            }
+            else
+            {
+                if(committed < block->committed)
+                {
+                    // Return the tail pages to the system
+                    static_cast<void>( ::VirtualFree(&memory[committed], block->committed - committed, MEM_DECOMMIT) );
+                    block->committed = committed;
+                }
+                res = true;
+            }
+        }
+    }
+    return res;
+}
+
+bool_t HeapLarge::construct() noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::SYSTEM_INFO info;
+        ::GetSystemInfo(&info);
+        pageSize_ = static_cast<size_t>(info.dwPageSize);
+        granularity_ = static_cast<size_t>(info.dwAllocationGranularity);
+        #ifdef EOOS_GLOBAL_SYS_HEAP_ENABLE_LARGE_PAGES
+        if( enableLargePages() )
+        {
+            largePageSize_ = static_cast<size_t>( ::GetLargePageMinimum() );
+        }
+        #endif // EOOS_GLOBAL_SYS_HEAP_ENABLE_LARGE_PAGES
+        res = (pageSize_ != 0U) && (granularity_ != 0U);
+    }
+    return res;
+}
+
+bool_t HeapLarge::enableLargePages() noexcept
+{
+    bool_t res{ false };
+    ::HANDLE token{ NULLPTR };
+    if( ::OpenProcessToken(::GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token) != 0 )
+    {
+        ::TOKEN_PRIVILEGES privileges;
+        privileges.PrivilegeCount = 1U;
+        privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+        if( ::LookupPrivilegeValue(NULL, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) != 0 )
+        {
+            // The function succeeds even if the privilege is not held, thus the last error has to be checked
+            ::BOOL const isAdjusted{ ::AdjustTokenPrivileges(token, FALSE, &privileges, 0U, NULL, NULL) };
+            res = (isAdjusted != 0) && (::GetLastError() == ERROR_SUCCESS);
+        }
+        static_cast<void>( ::CloseHandle(token) );
+    }
+    return res;
+}
+
+size_t HeapLarge::roundUp(size_t size, size_t boundary) noexcept
+{
+    size_t const mask{ boundary - 1U };
+    size_t const rounded{ (size + mask) & ~mask };
+    return (rounded < size) ? 0U : rounded;
+}
+
+HeapLarge::Block* HeapLarge::getBlock(void const* ptr) const noexcept
+{
+    // Memory given to user is always in the first granule of a reservation
+    ::ULONG_PTR const addr{ reinterpret_cast< ::ULONG_PTR >(ptr) - 1U };  ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+    ::ULONG_PTR const mask{ ~static_cast< ::ULONG_PTR >(granularity_ - 1U) };
+    return reinterpret_cast<Block*>(addr & mask); ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+}
+
+HeapLarge::Block* HeapLarge::findBlock(void const* ptr) const noexcept
+{
+    Block* res{ NULLPTR };
+    if( isConstructed() && (ptr != NULLPTR) )
+    {
+        ::ULONG_PTR const addr{ reinterpret_cast< ::ULONG_PTR >(ptr) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        // Memory given to user is aligned at least to the header size and placed after the header,
+        // so other memory is rejected without the table lookup. The header of other memory
+        // cannot be read, as its granule may be not committed.
+        ::ULONG_PTR const offset{ addr & static_cast< ::ULONG_PTR >(granularity_ - 1U) };
+        if( (offset >= HEADER_SIZE) && ((offset & (HEADER_SIZE - 1U)) == 0U) )
+        {
+            Block* const block{ getBlock(ptr) };
+            ::AcquireSRWLockShared(&lock_);
+            Block* it{ buckets_[getBucket(block)] };
+            while( (it != NULLPTR) && (it != block) )
+            {
+                it = it->next;
+            }
+            if( (it != NULLPTR) && (reinterpret_cast<ucell_t*>(it) + it->offset == ptr) ) ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+            {
+                res = it;
+            }
+            ::ReleaseSRWLockShared(&lock_);
+        }
+    }
+    return res;
+}
+
+size_t HeapLarge::getBucket(Block const* block) const noexcept
+{
+    // Reservations are aligned to the granularity, so the granule number is hashed
+    ::ULONG_PTR const granule{ reinterpret_cast< ::ULONG_PTR >(block) / static_cast< ::ULONG_PTR >(granularity_) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+    ::ULONG_PTR const hash{ granule * static_cast< ::ULONG_PTR >(0x9E3779B1U) };
+    return static_cast<size_t>(hash >> 8U) & (NUMBER_OF_BUCKETS - 1U);
+}
+
+} // namespace sys
+} // namespace eoos
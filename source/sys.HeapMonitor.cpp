@@ -0,0 +1,229 @@
+/**
+ * @file      sys.HeapMonitor.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.HeapMonitor.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+HeapMonitor::HeapMonitor() noexcept
+    : NonCopyable<NoAllocator>()
+    , HeapStatistics()
+    , histogram_()
+    , tagAllocations_()
+    , tagBytes_() {
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+HeapMonitor::~HeapMonitor() noexcept
+{
+    if(tagIndex_ != TLS_OUT_OF_INDEXES)
+    {
+        static_cast<void>( ::TlsFree(tagIndex_) );
+        tagIndex_ = TLS_OUT_OF_INDEXES;
+    }
+}
+
+bool_t HeapMonitor::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+bool_t HeapMonitor::isEnabled() const noexcept
+{
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
+    return isConstructed();
+    #else
+    return false;
+    #endif // EOOS_GLOBAL_SYS_ENABLE_HEAP_STATISTICS
+}
+
+bool_t HeapMonitor::getCounters(Counters& counters) const noexcept
+{
+    bool_t res{ false };
+    if( isEnabled() )
+    {
+        counters.liveBytes = getValue(liveBytes_);
+        counters.peakBytes = getValue(peakBytes_);
+        counters.allocations = getValue(allocations_);
+        counters.frees = getValue(frees_);
+        counters.failures = getValue(failures_);
+        counters.allocationRate = 0U;
+        ::LARGE_INTEGER now;
+        if( ::QueryPerformanceCounter(&now) != 0 )
+        {
+            ::LONGLONG const ticks{ now.QuadPart - start_ };
+            if(ticks > 0)
+            {
+                float64_t const seconds{ static_cast<float64_t>(ticks) / static_cast<float64_t>(frequency_) };
+                counters.allocationRate = static_cast<uint64_t>( static_cast<float64_t>(counters.allocations) / seconds );
+            }
+        }
+        res = true;
+    }
+    return res;
+}
+
+uint64_t HeapMonitor::getHistogram(int32_t bin) const noexcept
+{
+    uint64_t value{ 0U };
+    if( isEnabled() && (bin >= 0) && (bin < NUMBER_OF_BINS) )
+    {
+        value = getValue(histogram_[bin]);
+    }
+    return value;
+}
+
+uint64_t HeapMonitor::getTagAllocations(int32_t tag) const noexcept
+{
+    uint64_t value{ 0U };
+    if( isEnabled() && (tag >= 0) && (tag < NUMBER_OF_TAGS) )
+    {
+        value = getValue(tagAllocations_[tag]);
+    }
+    return value;
+}
+
+uint64_t HeapMonitor::getTagBytes(int32_t tag) const noexcept
+{
+    uint64_t value{ 0U };
+    if( isEnabled() && (tag >= 0) && (tag < NUMBER_OF_TAGS) )
+    {
+        value = getValue(tagBytes_[tag]);
+    }
+    return value;
+}
+
+int32_t HeapMonitor::setTag(int32_t tag) noexcept
+{
+    int32_t res{ -1 };
+    if( isEnabled() && (tag >= 0) && (tag < NUMBER_OF_TAGS) && (tagIndex_ != TLS_OUT_OF_INDEXES) )
+    {
+        int32_t const prev{ getTag() };
+        ::LPVOID const value{ reinterpret_cast< ::LPVOID >( static_cast< ::ULONG_PTR >(tag) ) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        if( ::TlsSetValue(tagIndex_, value) != 0 )
+        {
+            res = prev;
+        }
+    }
+    return res;
+}
+
+void HeapMonitor::reset() noexcept
+{
+    if( isEnabled() )
+    {
+        static_cast<void>( ::InterlockedExchange64(&peakBytes_, liveBytes_) );
+        static_cast<void>( ::InterlockedExchange64(&allocations_, 0) );
+        static_cast<void>( ::InterlockedExchange64(&frees_, 0) );
+        static_cast<void>( ::InterlockedExchange64(&failures_, 0) );
+        for(int32_t i{0}; i<NUMBER_OF_BINS; i++)
+        {
+            static_cast<void>( ::InterlockedExchange64(&histogram_[i], 0) );
+        }
+        for(int32_t i{0}; i<NUMBER_OF_TAGS; i++)
+        {
+            static_cast<void>( ::InterlockedExchange64(&tagAllocations_[i], 0) );
+            static_cast<void>( ::InterlockedExchange64(&tagBytes_[i], 0) );
+        }
+        ::LARGE_INTEGER now;
+        if( ::QueryPerformanceCounter(&now) != 0 )
+        {
+            start_ = now.QuadPart;
+        }
+    }
+}
+
+void HeapMonitor::recordAllocation(size_t size, size_t usable) noexcept
+{
+    static_cast<void>( ::InterlockedIncrement64(&allocations_) );
+    addLiveBytes( static_cast< ::LONG64 >(usable) );
+    int32_t bin{ 0 };
+    size_t value{ size >> 1 };
+    while( (value != 0U) && (bin < (NUMBER_OF_BINS - 1)) )
+    {
+        value >>= 1;
+        bin++;
+    }
+    static_cast<void>( ::InterlockedIncrement64(&histogram_[bin]) );
+    int32_t const tag{ getTag() };
+    static_cast<void>( ::InterlockedIncrement64(&tagAllocations_[tag]) );
+    static_cast<void>( ::InterlockedExchangeAdd64(&tagBytes_[tag], static_cast< ::LONG64 >(size)) );
+}
+
+void HeapMonitor::recordFailure() noexcept
+{
+    static_cast<void>( ::InterlockedIncrement64(&failures_) );
+}
+
+void HeapMonitor::recordFree(size_t usable) noexcept
+{
+    static_cast<void>( ::InterlockedIncrement64(&frees_) );
+    addLiveBytes( -static_cast< ::LONG64 >(usable) );
+}
+
+void HeapMonitor::recordResize(size_t oldUsable, size_t newUsable) noexcept
+{
+    addLiveBytes( static_cast< ::LONG64 >(newUsable) - static_cast< ::LONG64 >(oldUsable) );
+}
+
+bool_t HeapMonitor::construct() noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::LARGE_INTEGER frequency;
+        ::LARGE_INTEGER now;
+        if( (::QueryPerformanceFrequency(&frequency) != 0) && (::QueryPerformanceCounter(&now) != 0) )
+        {
+            frequency_ = frequency.QuadPart;
+            start_ = now.QuadPart;
+            // If no index is available, all allocations are accounted to zero tag
+            tagIndex_ = ::TlsAlloc();
+            res = true;
+        }
+    }
+    return res;
+}
+
+void HeapMonitor::addLiveBytes(::LONG64 bytes) noexcept
+{
+    ::LONG64 const live{ ::InterlockedExchangeAdd64(&liveBytes_, bytes) + bytes };
+    ::LONG64 peak{ peakBytes_ };
+    while(live > peak)
+    {
+        ::LONG64 const prev{ ::InterlockedCompareExchange64(&peakBytes_, live, peak) };
+        if(prev == peak)
+        {
+            break;
+        }
+        peak = prev;
+    }
+}
+
+int32_t HeapMonitor::getTag() const noexcept
+{
+    int32_t tag{ 0 };
+    if(tagIndex_ != TLS_OUT_OF_INDEXES)
+    {
+        ::ULONG_PTR const value{ reinterpret_cast< ::ULONG_PTR >( ::TlsGetValue(tagIndex_) ) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        tag = static_cast<int32_t>(value);
+    }
+    return tag;
+}
+
+uint64_t HeapMonitor::getValue(::LONG64 const volatile& counter) noexcept
+{
+    // Read the counter atomically also on 32-bit platforms
+    ::LONG64 volatile* const addr{ const_cast< ::LONG64 volatile* >(&counter) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-3
+    ::LONG64 const value{ ::InterlockedCompareExchange64(addr, 0, 0) };
+    return static_cast<uint64_t>(value);
+}
+
+} // namespace sys
+} // namespace eoos
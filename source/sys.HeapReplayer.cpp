@@ -0,0 +1,247 @@
+/**
+ * @file      sys.HeapReplayer.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.HeapReplayer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+HeapReplayer::HeapReplayer() noexcept
+    : NonCopyable<NoAllocator>()
+    , HeapBenchmark() {
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+bool_t HeapReplayer::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+bool_t HeapReplayer::replay(api::Heap& heap, HeapTrace::Record const* records, size_t count, Report& report) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() && (records != NULLPTR) && (count != 0U) )
+    {
+        // The map keeps no more entries than allocation records,
+        // so twice larger capacity leaves it half empty at most
+        size_t capacity{ 1U };
+        while(capacity <= (count * 2U))
+        {
+            capacity <<= 1;
+        }
+        size_t const size{ (capacity * sizeof(Entry)) + (count * sizeof(uint64_t)) };
+        // The committed memory is zeroed, thus all entries are EMPTY
+        ::LPVOID const memory{ ::VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE) };
+        if(memory != NULL)
+        {
+            Entry* const map{ static_cast<Entry*>(memory) };
+            uint64_t* const latencies{ reinterpret_cast<uint64_t*>(&map[capacity]) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+            size_t number{ 0U };
+            uint64_t failures{ 0U };
+            uint64_t liveBytes{ 0U };
+            uint64_t peakBytes{ 0U };
+            ::LARGE_INTEGER begin;
+            ::LARGE_INTEGER start;
+            ::LARGE_INTEGER end;
+            static_cast<void>( ::QueryPerformanceCounter(&begin) );
+            for(size_t i{0U}; i<count; i++)
+            {
+                HeapTrace::Record const& record{ records[i] };
+                if(record.size != HeapTrace::FREE)
+                {
+                    size_t const blockSize{ static_cast<size_t>(record.size) };
+                    static_cast<void>( ::QueryPerformanceCounter(&start) );
+                    void* const block{ heap.allocate(blockSize, NULLPTR) };
+                    static_cast<void>( ::QueryPerformanceCounter(&end) );
+                    latencies[number] = static_cast<uint64_t>(end.QuadPart - start.QuadPart);
+                    number++;
+                    if(block == NULLPTR)
+                    {
+                        failures++;
+                    }
+                    else if( (record.address == EMPTY) || (record.address == REMOVED) )
+                    {
+                        // The block cannot be freed by the trace
+                        heap.free(block);
+                    }
+                    else
+                    {
+                        insert(map, capacity, record.address, block, blockSize);
+                        liveBytes += blockSize;
+                        if(liveBytes > peakBytes)
+                        {
+                            peakBytes = liveBytes;
+                        }
+                    }
+                }
+                else
+                {
+                    Entry* const entry{ find(map, capacity, record.address) };
+                    // Blocks allocated before the first record are not known
+                    if(entry != NULLPTR)
+                    {
+                        static_cast<void>( ::QueryPerformanceCounter(&start) );
+                        heap.free(entry->block);
+                        static_cast<void>( ::QueryPerformanceCounter(&end) );
+                        latencies[number] = static_cast<uint64_t>(end.QuadPart - start.QuadPart);
+                        number++;
+                        liveBytes -= entry->size;
+                        entry->address = REMOVED;
+                    }
+                }
+            }
+            static_cast<void>( ::QueryPerformanceCounter(&end) );
+            ::LONGLONG const ticks{ end.QuadPart - begin.QuadPart };
+            for(size_t i{0U}; i<capacity; i++)
+            {
+                if( (map[i].address != EMPTY) && (map[i].address != REMOVED) )
+                {
+                    heap.free(map[i].block);
+                }
+            }
+            report.operations = static_cast<uint64_t>(number);
+            report.failures = failures;
+            report.throughput = 0U;
+            if(ticks > 0)
+            {
+                float64_t const seconds{ static_cast<float64_t>(ticks) / static_cast<float64_t>(frequency_) };
+                report.throughput = static_cast<uint64_t>( static_cast<float64_t>(number) / seconds );
+            }
+            sort(latencies, number);
+            report.latency50 = getPercentile(latencies, number, 500U);
+            report.latency90 = getPercentile(latencies, number, 900U);
+            report.latency99 = getPercentile(latencies, number, 990U);
+            report.latency999 = getPercentile(latencies, number, 999U);
+            report.latencyMax = getPercentile(latencies, number, 1000U);
+            report.peakBytes = peakBytes;
+            report.peakResident = 0U;
+            ::PROCESS_MEMORY_COUNTERS counters;
+            if( ::K32GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters)) != 0 )
+            {
+                report.peakResident = static_cast<uint64_t>(counters.PeakWorkingSetSize);
+            }
+            static_cast<void>( ::VirtualFree(memory, 0U, MEM_RELEASE) );
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t HeapReplayer::construct() noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::LARGE_INTEGER frequency;
+        if( ::QueryPerformanceFrequency(&frequency) != 0 )
+        {
+            frequency_ = frequency.QuadPart;
+            res = true;
+        }
+    }
+    return res;
+}
+
+void HeapReplayer::insert(Entry* map, size_t capacity, uint64_t address, void* block, size_t size) noexcept
+{
+    size_t index{ getIndex(address, capacity) };
+    while( (map[index].address != EMPTY) && (map[index].address != REMOVED) )
+    {
+        index = (index + 1U) & (capacity - 1U);
+    }
+    map[index].address = address;
+    map[index].block = block;
+    map[index].size = size;
+}
+
+HeapReplayer::Entry* HeapReplayer::find(Entry* map, size_t capacity, uint64_t address) noexcept
+{
+    Entry* entry{ NULLPTR };
+    size_t index{ getIndex(address, capacity) };
+    while( (entry == NULLPTR) && (map[index].address != EMPTY) )
+    {
+        if(map[index].address == address)
+        {
+            entry = &map[index];
+        }
+        index = (index + 1U) & (capacity - 1U);
+    }
+    return entry;
+}
+
+size_t HeapReplayer::getIndex(uint64_t address, size_t capacity) noexcept
+{
+    // Blocks are aligned, so low bits are dropped, and the rest are mixed by Fibonacci hashing
+    uint64_t const hash{ (address >> 4) * 0x9E3779B97F4A7C15U };
+    return static_cast<size_t>(hash >> 32) & (capacity - 1U);
+}
+
+void HeapReplayer::sort(uint64_t* values, size_t count) noexcept
+{
+    size_t root{ count / 2U };
+    while(root > 0U)
+    {
+        root--;
+        sift(values, root, count);
+    }
+    // Move the maximum of the heap to the end of the values one by one
+    size_t end{ count };
+    while(end > 1U)
+    {
+        end--;
+        uint64_t const value{ values[0] };
+        values[0] = values[end];
+        values[end] = value;
+        sift(values, 0U, end);
+    }
+}
+
+void HeapReplayer::sift(uint64_t* values, size_t root, size_t count) noexcept
+{
+    size_t parent{ root };
+    size_t child{ (parent * 2U) + 1U };
+    while(child < count)
+    {
+        if( ((child + 1U) < count) && (values[child] < values[child + 1U]) )
+        {
+            child++;
+        }
+        if(values[parent] < values[child])
+        {
+            uint64_t const value{ values[parent] };
+            values[parent] = values[child];
+            values[child] = value;
+            parent = child;
+            child = (parent * 2U) + 1U;
+        }
+        else
+        {
+            child = count;
+        }
+    }
+}
+
+uint64_t HeapReplayer::getPercentile(uint64_t const* latencies, size_t count, uint64_t permille) const noexcept
+{
+    uint64_t value{ 0U };
+    if(count != 0U)
+    {
+        // The nearest rank of the percentile
+        uint64_t rank{ ((static_cast<uint64_t>(count) * permille) + 999U) / 1000U };
+        if(rank == 0U)
+        {
+            rank = 1U;
+        }
+        uint64_t const ticks{ latencies[static_cast<size_t>(rank - 1U)] };
+        value = static_cast<uint64_t>( (static_cast<float64_t>(ticks) * 1000000000.0) / static_cast<float64_t>(frequency_) );
+    }
+    return value;
+}
+
+} // namespace sys
+} // namespace eoos
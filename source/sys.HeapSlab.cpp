@@ -0,0 +1,454 @@
+/**
+ * @file      sys.HeapSlab.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.HeapSlab.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+HeapSlab::HeapSlab() noexcept
+    : NonCopyable<NoAllocator>() {
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+HeapSlab::~HeapSlab() noexcept
+{
+    if(cacheIndex_ != FLS_OUT_OF_INDEXES)
+    {
+        // Freeing the index calls the callback for each thread having a cache
+        static_cast<void>( ::FlsFree(cacheIndex_) );
+        cacheIndex_ = FLS_OUT_OF_INDEXES;
+    }
+    if(region_ != NULLPTR)
+    {
+        static_cast<void>( ::VirtualFree(region_, 0U, MEM_RELEASE) );
+        region_ = NULLPTR;
+    }
+}
+
+bool_t HeapSlab::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+void* HeapSlab::allocate(size_t size) noexcept
+{
+    Block* block{ NULLPTR };
+    if( isConstructed() && (size <= MAX_BLOCK_SIZE) )
+    {
+        int32_t const index{ getClassIndex(size) };
+        Cache* const cache{ getCache() };
+        if(cache != NULLPTR)
+        {
+            Magazine& magazine{ cache->magazines[index] };
+            if( (magazine.owned == NULLPTR) && (magazine.head == NULLPTR) )
+            {
+                reclaim(*cache);
+            }
+            if( (magazine.owned == NULLPTR) && (magazine.head == NULLPTR) )
+            {
+                refill(*cache, index);
+            }
+            // Blocks of owned slabs are preferred as they are local to the thread NUMA node
+            block = magazine.owned;
+            if(block != NULLPTR)
+            {
+                magazine.owned = block->next;
+            }
+            else
+            {
+                block = magazine.head;
+                if(block != NULLPTR)
+                {
+                    magazine.head = block->next;
+                    magazine.count--;
+                }
+            }
+        }
+        else
+        {
+            block = allocateBlock(index);
+        }
+    }
+    return block;
+}
+
+void HeapSlab::free(void* ptr) noexcept
+{
+    if( isOwned(ptr) )
+    {
+        Slab const* const slab{ getSlab(ptr) };
+        int32_t const index{ slab->index };
+        Block* const block{ static_cast<Block*>(ptr) }; ///< SCA AUTOSAR-C++14 Justified Rule M5-2-8
+        Cache* const cache{ getCache() };
+        Cache* const owner{ slab->owner };
+        if(cache == NULLPTR)
+        {
+            freeBlock(block, index);
+        }
+        else if(owner == cache)
+        {
+            Magazine& magazine{ cache->magazines[index] };
+            block->next = magazine.owned;
+            magazine.owned = block;
+        }
+        else if(owner == NULLPTR)
+        {
+            cacheBlock(*cache, block, index);
+        }
+        else
+        {
+            pushRemote(*owner, block);
+        }
+    }
+}
+
+bool_t HeapSlab::isOwned(void const* ptr) const noexcept
+{
+    bool_t res{ false };
+    if( (ptr != NULLPTR) && (region_ != NULLPTR) )
+    {
+        ::ULONG_PTR const addr{ reinterpret_cast< ::ULONG_PTR >(ptr) };       ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        ::ULONG_PTR const begin{ reinterpret_cast< ::ULONG_PTR >(region_) };  ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        res = (addr >= begin) && (addr < (begin + REGION_SIZE));
+    }
+    return res;
+}
+
+size_t HeapSlab::getSize(void const* ptr) const noexcept
+{
+    size_t size{ 0U };
+    if( isOwned(ptr) )
+    {
+        Slab const* const slab{ getSlab(ptr) };
+        size = getClassSize(slab->index);
+    }
+    return size;
+}
+
+bool_t HeapSlab::construct() noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        for(int32_t i{0}; i<NUMBER_OF_CLASSES; i++)
+        {
+            ::InitializeSRWLock(&classes_[i].lock);
+            classes_[i].head = NULLPTR;
+        }
+        ::InitializeSRWLock(&orphansLock_);
+        // The reservation is aligned to the allocation granularity,
+        // thus every slab is aligned to its size and a slab header
+        // is found by clearing low bits of any block address.
+        ::LPVOID const region{ ::VirtualAlloc(NULL, REGION_SIZE, MEM_RESERVE, PAGE_READWRITE) };
+        if(region != NULL)
+        {
+            region_ = static_cast<ucell_t*>(region);
+            // If no index is available, the allocator works without thread caches
+            cacheIndex_ = ::FlsAlloc(&destroyCache);
+            res = true;
+        }
+    }
+    return res;
+}
+
+int32_t HeapSlab::getClassIndex(size_t size) noexcept
+{
+    int32_t index{ 0 };
+    size_t blockSize{ MIN_BLOCK_SIZE };
+    while(blockSize < size)
+    {
+        blockSize <<= 1;
+        index++;
+    }
+    return index;
+}
+
+size_t HeapSlab::getClassSize(int32_t index) noexcept
+{
+    return MIN_BLOCK_SIZE << index;
+}
+
+int32_t HeapSlab::getBatchSize(int32_t index) noexcept
+{
+    size_t const count{ BATCH_BYTES / getClassSize(index) };
+    int32_t batch{ static_cast<int32_t>(count) };
+    if(batch > 64)
+    {
+        batch = 64;
+    }
+    else if(batch < 4)
+    {
+        batch = 4;
+    }
+    else
+    {
+        // The batch size is in the range
+    }
+    return batch;
+}
+
+HeapSlab::Slab* HeapSlab::getSlab(void const* ptr) noexcept
+{
+    ::ULONG_PTR const addr{ reinterpret_cast< ::ULONG_PTR >(ptr) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+    ::ULONG_PTR const mask{ ~static_cast< ::ULONG_PTR >(SLAB_SIZE - 1U) };
+    return reinterpret_cast<Slab*>(addr & mask); ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+}
+
+bool_t HeapSlab::createSlab(int32_t index, Cache* owner) noexcept
+{
+    bool_t res{ false };
+    ::LONG const maxSlabs{ static_cast< ::LONG >(REGION_SIZE / SLAB_SIZE) };
+    ::LONG number{ numberOfSlabs_ };
+    while(number < maxSlabs)
+    {
+        ::LONG const prev{ ::InterlockedCompareExchange(&numberOfSlabs_, number + 1, number) };
+        if(prev == number)
+        {
+            res = true;
+            break;
+        }
+        number = prev;
+    }
+    if(res == true)
+    {
+        ucell_t* const memory{ &region_[static_cast<size_t>(number) * SLAB_SIZE] };
+        // A slab of a thread cache is committed on the NUMA node the thread runs on
+        ::DWORD node{ NUMA_NO_PREFERRED_NODE };
+        if(owner != NULLPTR)
+        {
+            ::PROCESSOR_NUMBER processor;
+            ::USHORT nodeNumber{ 0U };
+            ::GetCurrentProcessorNumberEx(&processor);
+            if( ::GetNumaProcessorNodeEx(&processor, &nodeNumber) != 0 )
+            {
+                node = static_cast< ::DWORD >(nodeNumber);
+            }
+        }
+        if( ::VirtualAllocExNuma(::GetCurrentProcess(), memory, SLAB_SIZE, MEM_COMMIT, PAGE_READWRITE, node) != NULL )
+        {
+            Slab* const slab{ reinterpret_cast<Slab*>(memory) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+            slab->index = index;
+            slab->owner = owner;
+            size_t const blockSize{ getClassSize(index) };
+            Block** const list{ (owner != NULLPTR) ? &owner->magazines[index].owned : &classes_[index].head };
+            Block* head{ *list };
+            // Link blocks from the end of the slab to leave them in address order in the list
+            size_t offset{ SLAB_SIZE - ((SLAB_SIZE - SLAB_HEADER_SIZE) % blockSize) };
+            while(offset > SLAB_HEADER_SIZE)
+            {
+                offset -= blockSize;
+                Block* const block{ reinterpret_cast<Block*>(&memory[offset]) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+                block->next = head;
+                head = block;
+            }
+            *list = head;
+        }
+        else
+        {
+            res = false;
+        }
+    }
+    return res;
+}
+
+HeapSlab::Block* HeapSlab::allocateBlock(int32_t index) noexcept
+{
+    Class& cls{ classes_[index] };
+    ::AcquireSRWLockExclusive(&cls.lock);
+    if(cls.head == NULLPTR)
+    {
+        static_cast<void>( createSlab(index, NULLPTR) );
+    }
+    Block* const block{ cls.head };
+    if(block != NULLPTR)
+    {
+        cls.head = block->next;
+    }
+    ::ReleaseSRWLockExclusive(&cls.lock);
+    return block;
+}
+
+void HeapSlab::freeBlock(Block* block, int32_t index) noexcept
+{
+    Class& cls{ classes_[index] };
+    ::AcquireSRWLockExclusive(&cls.lock);
+    block->next = cls.head;
+    cls.head = block;
+    ::ReleaseSRWLockExclusive(&cls.lock);
+}
+
+HeapSlab::Cache* HeapSlab::getCache() noexcept
+{
+    Cache* cache{ NULLPTR };
+    if(cacheIndex_ != FLS_OUT_OF_INDEXES)
+    {
+        cache = static_cast<Cache*>( ::FlsGetValue(cacheIndex_) );
+        if(cache == NULLPTR)
+        {
+            cache = createCache();
+            if( (cache != NULLPTR) && (::FlsSetValue(cacheIndex_, cache) == 0) )
+            {
+                // Keep the cache for other threads as it might own slabs
+                ::AcquireSRWLockExclusive(&orphansLock_);
+                cache->next = orphans_;
+                orphans_ = cache;
+                ::ReleaseSRWLockExclusive(&orphansLock_);
+                cache = NULLPTR;
+            }
+        }
+    }
+    return cache;
+}
+
+HeapSlab::Cache* HeapSlab::createCache() noexcept
+{
+    ::AcquireSRWLockExclusive(&orphansLock_);
+    Cache* cache{ orphans_ };
+    if(cache != NULLPTR)
+    {
+        orphans_ = cache->next;
+    }
+    ::ReleaseSRWLockExclusive(&orphansLock_);
+    if(cache == NULLPTR)
+    {
+        // The cache itself is allocated from the depot bypassing caches
+        Block* const block{ allocateBlock( getClassIndex(sizeof(Cache)) ) };
+        if(block != NULLPTR)
+        {
+            cache = reinterpret_cast<Cache*>(block); ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+            cache->heap = this;
+            cache->remote = NULLPTR;
+            for(int32_t i{0}; i<NUMBER_OF_CLASSES; i++)
+            {
+                cache->magazines[i].head = NULLPTR;
+                cache->magazines[i].count = 0;
+                cache->magazines[i].owned = NULLPTR;
+            }
+        }
+    }
+    if(cache != NULLPTR)
+    {
+        cache->next = NULLPTR;
+    }
+    return cache;
+}
+
+void HeapSlab::cacheBlock(Cache& cache, Block* block, int32_t index) noexcept
+{
+    Magazine& magazine{ cache.magazines[index] };
+    block->next = magazine.head;
+    magazine.head = block;
+    magazine.count++;
+    int32_t const batch{ getBatchSize(index) };
+    if(magazine.count > (batch * 2))
+    {
+        flush(magazine, index, batch);
+    }
+}
+
+void HeapSlab::pushRemote(Cache& owner, Block* block) noexcept
+{
+    // Blocks are only pushed one by one and taken all at once, so the queue is free of ABA problem
+    ::PVOID head{ owner.remote };
+    while(true)
+    {
+        block->next = static_cast<Block*>(head);
+        ::PVOID const prev{ ::InterlockedCompareExchangePointer(&owner.remote, block, head) };
+        if(prev == head)
+        {
+            break;
+        }
+        head = prev;
+    }
+}
+
+void HeapSlab::reclaim(Cache& cache) noexcept
+{
+    if(cache.remote != NULLPTR)
+    {
+        Block* block{ static_cast<Block*>( ::InterlockedExchangePointer(&cache.remote, NULLPTR) ) };
+        // Only blocks of slabs owned by the cache are pushed to its remote queue
+        while(block != NULLPTR)
+        {
+            Block* const next{ block->next };
+            Magazine& magazine{ cache.magazines[ getSlab(block)->index ] };
+            block->next = magazine.owned;
+            magazine.owned = block;
+            block = next;
+        }
+    }
+}
+
+void HeapSlab::refill(Cache& cache, int32_t index) noexcept
+{
+    Magazine& magazine{ cache.magazines[index] };
+    Class& cls{ classes_[index] };
+    int32_t const batch{ getBatchSize(index) };
+    ::AcquireSRWLockExclusive(&cls.lock);
+    while( (magazine.count < batch) && (cls.head != NULLPTR) )
+    {
+        Block* const block{ cls.head };
+        cls.head = block->next;
+        block->next = magazine.head;
+        magazine.head = block;
+        magazine.count++;
+    }
+    ::ReleaseSRWLockExclusive(&cls.lock);
+    if(magazine.head == NULLPTR)
+    {
+        static_cast<void>( createSlab(index, &cache) );
+    }
+}
+
+void HeapSlab::flush(Magazine& magazine, int32_t index, int32_t count) noexcept
+{
+    Block* const head{ magazine.head };
+    if( (head != NULLPTR) && (count > 0) )
+    {
+        // Cut the chain of blocks off the magazine to splice it to the depot under the lock at once
+        Block* tail{ head };
+        int32_t number{ 1 };
+        while( (number < count) && (tail->next != NULLPTR) )
+        {
+            tail = tail->next;
+            number++;
+        }
+        magazine.head = tail->next;
+        magazine.count -= number;
+        Class& cls{ classes_[index] };
+        ::AcquireSRWLockExclusive(&cls.lock);
+        tail->next = cls.head;
+        cls.head = head;
+        ::ReleaseSRWLockExclusive(&cls.lock);
+    }
+}
+
+void WINAPI HeapSlab::destroyCache(::PVOID data)
+{
+    Cache* const cache{ static_cast<Cache*>(data) };
+    if(cache != NULLPTR)
+    {
+        HeapSlab* const heap{ cache->heap };
+        heap->reclaim(*cache);
+        for(int32_t i{0}; i<NUMBER_OF_CLASSES; i++)
+        {
+            Magazine& magazine{ cache->magazines[i] };
+            heap->flush(magazine, i, magazine.count);
+        }
+        // Blocks of owned slabs stay in the cache, and other threads may still push such blocks
+        // to its remote queue, so the cache is not freed but kept for a new thread which uses them
+        ::AcquireSRWLockExclusive(&heap->orphansLock_);
+        cache->next = heap->orphans_;
+        heap->orphans_ = cache;
+        ::ReleaseSRWLockExclusive(&heap->orphansLock_);
+    }
+}
+
+} // namespace sys
+} // namespace eoos
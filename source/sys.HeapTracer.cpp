@@ -0,0 +1,145 @@
+/**
+ * @file      sys.HeapTracer.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.HeapTracer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+HeapTracer::HeapTracer() noexcept
+    : NonCopyable<NoAllocator>()
+    , HeapTrace() {
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+HeapTracer::~HeapTracer() noexcept
+{
+    if(records_ != NULLPTR)
+    {
+        static_cast<void>( ::VirtualFree(records_, 0U, MEM_RELEASE) );
+        records_ = NULLPTR;
+    }
+}
+
+bool_t HeapTracer::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+bool_t HeapTracer::isEnabled() const noexcept
+{
+    return isConstructed() && (records_ != NULLPTR);
+}
+
+bool_t HeapTracer::start() noexcept
+{
+    bool_t res{ false };
+    if( isEnabled() )
+    {
+        static_cast<void>( ::InterlockedExchange(&isRecording_, 1) );
+        res = true;
+    }
+    return res;
+}
+
+void HeapTracer::stop() noexcept
+{
+    static_cast<void>( ::InterlockedExchange(&isRecording_, 0) );
+}
+
+uint64_t HeapTracer::getFrequency() const noexcept
+{
+    return static_cast<uint64_t>(frequency_);
+}
+
+uint64_t HeapTracer::getNumberOfRecords() const noexcept
+{
+    // Read the position atomically also on 32-bit platforms
+    ::LONG64 volatile* const addr{ const_cast< ::LONG64 volatile* >(&position_) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-3
+    return static_cast<uint64_t>( ::InterlockedCompareExchange64(addr, 0, 0) );
+}
+
+size_t HeapTracer::getRecords(Record* records, size_t count) const noexcept
+{
+    size_t number{ 0U };
+    if( isEnabled() && (records != NULLPTR) )
+    {
+        uint64_t const total{ getNumberOfRecords() };
+        uint64_t available{ (total < CAPACITY) ? total : static_cast<uint64_t>(CAPACITY) };
+        if(available > count)
+        {
+            available = count;
+        }
+        number = static_cast<size_t>(available);
+        uint64_t const first{ total - available };
+        for(size_t i{0U}; i<number; i++)
+        {
+            size_t const index{ static_cast<size_t>(first + i) & (CAPACITY - 1U) };
+            records[i] = records_[index];
+        }
+    }
+    return number;
+}
+
+void HeapTracer::reset() noexcept
+{
+    static_cast<void>( ::InterlockedExchange64(&position_, 0) );
+}
+
+void HeapTracer::recordAllocation(void const* ptr, size_t size) noexcept
+{
+    // Sizes which do not fit the record are saturated to be distinguished from frees
+    uint32_t const value{ (size < static_cast<size_t>(FREE)) ? static_cast<uint32_t>(size) : (FREE - 1U) };
+    record(ptr, value);
+}
+
+void HeapTracer::recordFree(void const* ptr) noexcept
+{
+    record(ptr, FREE);
+}
+
+bool_t HeapTracer::construct() noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::LARGE_INTEGER frequency;
+        if( ::QueryPerformanceFrequency(&frequency) != 0 )
+        {
+            frequency_ = frequency.QuadPart;
+            #ifdef EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE
+            // The ring buffer is not allocated from the heap to not trace itself
+            ::LPVOID const records{ ::VirtualAlloc(NULL, CAPACITY * sizeof(Record), MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE) };
+            records_ = static_cast<Record*>(records);
+            #endif // EOOS_GLOBAL_SYS_ENABLE_HEAP_TRACE
+            res = true;
+        }
+    }
+    return res;
+}
+
+void HeapTracer::record(void const* ptr, uint32_t size) noexcept
+{
+    if( (isRecording_ != 0) && (records_ != NULLPTR) )
+    {
+        ::LARGE_INTEGER now;
+        if( ::QueryPerformanceCounter(&now) == 0 )
+        {
+            now.QuadPart = 0;
+        }
+        ::LONG64 const position{ ::InterlockedIncrement64(&position_) - 1 };
+        Record& record{ records_[static_cast<size_t>(position) & (CAPACITY - 1U)] };
+        record.timestamp = static_cast<uint64_t>(now.QuadPart);
+        record.address = static_cast<uint64_t>( reinterpret_cast< ::ULONG_PTR >(ptr) ); ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+        record.size = size;
+        record.thread = static_cast<uint32_t>( ::GetCurrentThreadId() );
+    }
+}
+
+} // namespace sys
+} // namespace eoos
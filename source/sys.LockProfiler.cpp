@@ -0,0 +1,292 @@
+/**
+ * @file      sys.LockProfiler.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.LockProfiler.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+::SRWLOCK LockProfiler::lock_ = SRWLOCK_INIT;
+
+LockProfiler::Probe* LockProfiler::probes_{ NULLPTR };
+
+LockProfiler::Probe::Probe(void const* lock, Type type) noexcept
+    : NonCopyable<NoAllocator>()
+    , lock_( lock )
+    , type_( type ) {
+    LockProfiler::attach(*this);
+}
+
+LockProfiler::Probe::~Probe() noexcept
+{
+    LockProfiler::detach(*this);
+}
+
+::LONGLONG LockProfiler::Probe::beginWait() noexcept
+{
+    static_cast<void>( ::InterlockedIncrement64(&contentions_) );
+    static_cast<void>( ::InterlockedExchange(&contendedOwner_, owner_) );
+    ::LARGE_INTEGER now;
+    if( ::QueryPerformanceCounter(&now) == 0 )
+    {
+        now.QuadPart = 0;
+    }
+    return now.QuadPart;
+}
+
+void LockProfiler::Probe::endWait(::LONGLONG begin) noexcept
+{
+    ::LARGE_INTEGER now;
+    if( (::QueryPerformanceCounter(&now) != 0) && (now.QuadPart > begin) )
+    {
+        ::LONG64 const time{ now.QuadPart - begin };
+        static_cast<void>( ::InterlockedExchangeAdd64(&waitTime_, time) );
+        ::LONG64 max{ maxWaitTime_ };
+        while(time > max)
+        {
+            ::LONG64 const prev{ ::InterlockedCompareExchange64(&maxWaitTime_, time, max) };
+            if(prev == max)
+            {
+                break;
+            }
+            max = prev;
+        }
+    }
+}
+
+void LockProfiler::Probe::acquire() noexcept
+{
+    static_cast<void>( ::InterlockedIncrement64(&acquisitions_) );
+    ::LONG const thread{ static_cast< ::LONG >( ::GetCurrentThreadId() ) };
+    if( (depth_ == 0) || (owner_ != thread) )
+    {
+        static_cast<void>( ::InterlockedExchange(&owner_, thread) );
+        depth_ = 0;
+        ::LARGE_INTEGER now;
+        if( ::QueryPerformanceCounter(&now) != 0 )
+        {
+            acquireTime_ = now.QuadPart;
+        }
+    }
+    depth_++;
+}
+
+void LockProfiler::Probe::take() noexcept
+{
+    static_cast<void>( ::InterlockedIncrement64(&acquisitions_) );
+}
+
+void LockProfiler::Probe::release() noexcept
+{
+    if(depth_ > 0)
+    {
+        depth_--;
+    }
+    ::LARGE_INTEGER now;
+    if( (depth_ == 0) && (::QueryPerformanceCounter(&now) != 0) && (now.QuadPart > acquireTime_) )
+    {
+        static_cast<void>( ::InterlockedExchangeAdd64(&holdTime_, now.QuadPart - acquireTime_) );
+    }
+}
+
+LockProfiler::LockProfiler() noexcept
+    : NonCopyable<NoAllocator>()
+    , LockStatistics() {
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+bool_t LockProfiler::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+bool_t LockProfiler::isEnabled() const noexcept
+{
+    #ifdef EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+    return isConstructed();
+    #else
+    return false;
+    #endif // EOOS_GLOBAL_SYS_ENABLE_LOCK_PROFILER
+}
+
+size_t LockProfiler::getNumberOfLocks() const noexcept
+{
+    size_t number{ 0U };
+    if( isEnabled() )
+    {
+        ::AcquireSRWLockShared(&lock_);
+        for(Probe const* probe{ probes_ }; probe != NULLPTR; probe = probe->next_)
+        {
+            number++;
+        }
+        ::ReleaseSRWLockShared(&lock_);
+    }
+    return number;
+}
+
+size_t LockProfiler::getCounters(Counters* counters, size_t count) const noexcept
+{
+    size_t number{ 0U };
+    if( isEnabled() && (counters != NULLPTR) )
+    {
+        ::AcquireSRWLockShared(&lock_);
+        for(Probe const* probe{ probes_ }; (probe != NULLPTR) && (number < count); probe = probe->next_)
+        {
+            getCounters(*probe, counters[number]);
+            number++;
+        }
+        ::ReleaseSRWLockShared(&lock_);
+    }
+    return number;
+}
+
+void LockProfiler::dump(api::OutStream<char_t>& stream) const noexcept
+{
+    if( isEnabled() )
+    {
+        ::AcquireSRWLockShared(&lock_);
+        for(Probe const* probe{ probes_ }; probe != NULLPTR; probe = probe->next_)
+        {
+            Counters counters;
+            getCounters(*probe, counters);
+            if(counters.contentions != 0U)
+            {
+                stream << ( (counters.type == Type::MUTEX) ? "Mutex 0x" : "Semaphore 0x" );
+                print(stream, counters.lock, 16U);
+                stream << ": acquisitions ";
+                print(stream, counters.acquisitions, 10U);
+                stream << ", contentions ";
+                print(stream, counters.contentions, 10U);
+                stream << ", wait us ";
+                print(stream, counters.waitTime, 10U);
+                stream << ", max wait us ";
+                print(stream, counters.maxWaitTime, 10U);
+                stream << ", hold us ";
+                print(stream, counters.holdTime, 10U);
+                stream << ", owner ";
+                print(stream, counters.owner, 10U);
+                stream << "\n";
+            }
+        }
+        ::ReleaseSRWLockShared(&lock_);
+        static_cast<void>( stream.flush() );
+    }
+}
+
+void LockProfiler::reset() noexcept
+{
+    if( isEnabled() )
+    {
+        ::AcquireSRWLockShared(&lock_);
+        for(Probe* probe{ probes_ }; probe != NULLPTR; probe = probe->next_)
+        {
+            static_cast<void>( ::InterlockedExchange64(&probe->acquisitions_, 0) );
+            static_cast<void>( ::InterlockedExchange64(&probe->contentions_, 0) );
+            static_cast<void>( ::InterlockedExchange64(&probe->waitTime_, 0) );
+            static_cast<void>( ::InterlockedExchange64(&probe->maxWaitTime_, 0) );
+            static_cast<void>( ::InterlockedExchange64(&probe->holdTime_, 0) );
+        }
+        ::ReleaseSRWLockShared(&lock_);
+    }
+}
+
+bool_t LockProfiler::construct() noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::LARGE_INTEGER frequency;
+        if( ::QueryPerformanceFrequency(&frequency) != 0 )
+        {
+            frequency_ = frequency.QuadPart;
+            res = true;
+        }
+    }
+    return res;
+}
+
+void LockProfiler::getCounters(Probe const& probe, Counters& counters) const noexcept
+{
+    // Read the counters atomically also on 32-bit platforms
+    ::LONG64 volatile* const acquisitions{ const_cast< ::LONG64 volatile* >(&probe.acquisitions_) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-3
+    ::LONG64 volatile* const contentions{ const_cast< ::LONG64 volatile* >(&probe.contentions_) };   ///< SCA AUTOSAR-C++14 Justified Rule A5-2-3
+    counters.lock = static_cast<uint64_t>( reinterpret_cast< ::ULONG_PTR >(probe.lock_) ); ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+    counters.type = probe.type_;
+    counters.owner = static_cast<uint32_t>(probe.contendedOwner_);
+    counters.acquisitions = static_cast<uint64_t>( ::InterlockedCompareExchange64(acquisitions, 0, 0) );
+    counters.contentions = static_cast<uint64_t>( ::InterlockedCompareExchange64(contentions, 0, 0) );
+    counters.waitTime = toMicroseconds(probe.waitTime_);
+    counters.maxWaitTime = toMicroseconds(probe.maxWaitTime_);
+    counters.holdTime = toMicroseconds(probe.holdTime_);
+}
+
+uint64_t LockProfiler::toMicroseconds(::LONG64 const volatile& ticks) const noexcept
+{
+    ::LONG64 volatile* const addr{ const_cast< ::LONG64 volatile* >(&ticks) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-3
+    ::LONG64 const value{ ::InterlockedCompareExchange64(addr, 0, 0) };
+    uint64_t time{ 0U };
+    if( (value > 0) && (frequency_ > 0) )
+    {
+        // Split the conversion to avoid an overflow of the product
+        uint64_t const frequency{ static_cast<uint64_t>(frequency_) };
+        uint64_t const seconds{ static_cast<uint64_t>(value) / frequency };
+        uint64_t const rest{ static_cast<uint64_t>(value) % frequency };
+        time = (seconds * 1000000U) + ((rest * 1000000U) / frequency);
+    }
+    return time;
+}
+
+void LockProfiler::print(api::OutStream<char_t>& stream, uint64_t value, uint32_t base) noexcept
+{
+    char_t const* const digits{ "0123456789ABCDEF" };
+    // 64 binary digits at most and the terminating null character
+    char_t buffer[65];
+    int32_t index{ 64 };
+    buffer[index] = '\0';
+    do
+    {
+        index--;
+        buffer[index] = digits[value % base];
+        value /= base;
+    } while(value != 0U);
+    stream << &buffer[index];
+}
+
+void LockProfiler::attach(Probe& probe) noexcept
+{
+    ::AcquireSRWLockExclusive(&lock_);
+    probe.prev_ = NULLPTR;
+    probe.next_ = probes_;
+    if(probes_ != NULLPTR)
+    {
+        probes_->prev_ = &probe;
+    }
+    probes_ = &probe;
+    ::ReleaseSRWLockExclusive(&lock_);
+}
+
+void LockProfiler::detach(Probe& probe) noexcept
+{
+    ::AcquireSRWLockExclusive(&lock_);
+    if(probe.prev_ != NULLPTR)
+    {
+        probe.prev_->next_ = probe.next_;
+    }
+    else
+    {
+        probes_ = probe.next_;
+    }
+    if(probe.next_ != NULLPTR)
+    {
+        probe.next_->prev_ = probe.prev_;
+    }
+    ::ReleaseSRWLockExclusive(&lock_);
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,97 @@
+/**
+ * @file      sys.MultiWaiter.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.MultiWaiter.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+MultiWaiter::MultiWaiter() noexcept
+    : NonCopyable<NoAllocator>()
+    , MultiWait() {
+    bool_t const isConstructed{ MAXIMUM_NUMBER < static_cast<int32_t>(MAXIMUM_WAIT_OBJECTS) };
+    setConstructed( isConstructed );
+}
+
+bool_t MultiWaiter::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+int32_t MultiWaiter::waitAny(Waitable* const* objects, int32_t number) noexcept try
+{
+    return wait(objects, number, false, NULLPTR);
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return NONE;
+}
+
+int32_t MultiWaiter::waitAny(Waitable* const* objects, int32_t number, uint64_t timeoutUs) noexcept try
+{
+    int32_t res{ NONE };
+    Timeout timeout( timeoutUs );
+    if( timeout.isConstructed() )
+    {
+        res = wait(objects, number, false, &timeout);
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return NONE;
+}
+
+bool_t MultiWaiter::waitAll(Waitable* const* objects, int32_t number) noexcept try
+{
+    return wait(objects, number, true, NULLPTR) != NONE;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+bool_t MultiWaiter::waitAll(Waitable* const* objects, int32_t number, uint64_t timeoutUs) noexcept try
+{
+    bool_t res{ false };
+    Timeout timeout( timeoutUs );
+    if( timeout.isConstructed() )
+    {
+        res = wait(objects, number, true, &timeout) != NONE;
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+int32_t MultiWaiter::wait(Waitable* const* objects, int32_t number, bool_t isAll, Timeout* const timeout) noexcept
+{
+    int32_t res{ NONE };
+    if( isConstructed() && (objects != NULLPTR) && (number > 0) && (number <= MAXIMUM_NUMBER) )
+    {
+        ::HANDLE handles[MAXIMUM_WAIT_OBJECTS];
+        bool_t isWaitable{ true };
+        for(int32_t i{0}; i<number; i++)
+        {
+            handles[i] = (objects[i] != NULLPTR) ? objects[i]->getWaitHandle() : NULLPTR;
+            if(handles[i] == NULLPTR)
+            {
+                isWaitable = false;
+                break;
+            }
+        }
+        if(isWaitable)
+        {
+            ::DWORD const count{ static_cast< ::DWORD >(number) };
+            ::DWORD const error{ (timeout != NULLPTR) ? timeout->wait(handles, count, isAll)
+                                                      : ::WaitForMultipleObjects(count, handles, isAll ? TRUE : FALSE, INFINITE) };
+            // No kernel mutexes are waited for, thus no object can be abandoned
+            if( error < (static_cast< ::DWORD >(WAIT_OBJECT_0) + count) )
+            {
+                res = static_cast<int32_t>(error - static_cast< ::DWORD >(WAIT_OBJECT_0));
+            }
+        }
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
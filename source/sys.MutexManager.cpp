@@ -5,6 +5,9 @@
  */
 #include "sys.MutexManager.hpp"
 #include "sys.Mutex.hpp"
+#include "sys.MutexSlim.hpp"
+#include "sys.MutexFair.hpp"
+#include "sys.ResourcePool.hpp"
 #include "lib.UniquePointer.hpp"
 
 namespace eoos
@@ -12,6 +15,28 @@ namespace eoos
 namespace sys
 {
 
+struct MutexManager::Pool
+{
+    /**
+     * @brief Memory of mutexes of the default type.
+     */
+    ResourcePool<sizeof(Mutex<MutexManager>), EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXES> mutexes;
+
+    /**
+     * @brief Memory of slim mutexes.
+     */
+    ResourcePool<sizeof(MutexSlim<MutexManager>), EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXES> slimMutexes;
+
+    /**
+     * @brief Memory of fair mutexes.
+     */
+    ResourcePool<sizeof(MutexFair<MutexManager>), EOOS_GLOBAL_SYS_NUMBER_OF_MUTEXES> fairMutexes;
+};
+
+MutexManager::Pool MutexManager::pool_{};
+
+const MutexManager::SpinPolicy MutexManager::DEFAULT_POLICY{ 4000U, false };
+
 MutexManager::MutexManager() noexcept 
     : NonCopyable<NoAllocator>()
     , api::MutexManager() {
@@ -23,12 +48,37 @@ bool_t MutexManager::isConstructed() const noexcept
     return Parent::isConstructed();
 }    
 
-api::Mutex* MutexManager::create() noexcept try
+TimedMutex* MutexManager::create() noexcept
+{
+    return create(Type::DEFAULT, DEFAULT_POLICY);
+}
+
+TimedMutex* MutexManager::create(Type type) noexcept
 {
-    lib::UniquePointer<api::Mutex> res;
+    return create(type, DEFAULT_POLICY);
+}
+
+TimedMutex* MutexManager::create(Type type, SpinPolicy const& policy) noexcept try
+{
+    lib::UniquePointer<TimedMutex> res;
     if( isConstructed() )
     {   
-        res.reset( new Mutex<Allocator>() ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        if(type == Type::DEFAULT)
+        {
+            res.reset( new Mutex<MutexManager>(policy.spinCount, policy.isAdaptive) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        }
+        else if(type == Type::SLIM)
+        {
+            res.reset( new MutexSlim<MutexManager>() ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        }
+        else if(type == Type::FAIR)
+        {
+            res.reset( new MutexFair<MutexManager>(policy.spinCount) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        }
+        else
+        {
+            // The type is unknown
+        }
         if( !res.isNull() )
         {
             if( !res->isConstructed() )
@@ -42,5 +92,52 @@ api::Mutex* MutexManager::create() noexcept try
     return NULLPTR;
 }
 
+void* MutexManager::allocate(size_t size)
+{
+    // Slim and fair mutexes are taken from their own pools to not waste bigger slots
+    void* addr{ NULLPTR };
+    if( size <= sizeof(MutexSlim<MutexManager>) )
+    {
+        addr = pool_.slimMutexes.allocate(size);
+    }
+    else if( size <= sizeof(MutexFair<MutexManager>) )
+    {
+        addr = pool_.fairMutexes.allocate(size);
+    }
+    else
+    {
+        // The mutex is of the default type
+    }
+    if(addr == NULLPTR)
+    {
+        addr = pool_.mutexes.allocate(size);
+    }
+    if(addr == NULLPTR)
+    {
+        addr = Allocator::allocate(size);
+    }
+    return addr;
+}
+
+void MutexManager::free(void* ptr)
+{
+    if( pool_.slimMutexes.isOwned(ptr) )
+    {
+        pool_.slimMutexes.free(ptr);
+    }
+    else if( pool_.fairMutexes.isOwned(ptr) )
+    {
+        pool_.fairMutexes.free(ptr);
+    }
+    else if( pool_.mutexes.isOwned(ptr) )
+    {
+        pool_.mutexes.free(ptr);
+    }
+    else
+    {
+        Allocator::free(ptr);
+    }
+}
+
 } // namespace sys
 } // namespace eoos
@@ -0,0 +1,273 @@
+/**
+ * @file      sys.ProcessorTopology.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ProcessorTopology.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+struct ProcessorTopology::Pool
+{
+    /**
+     * @brief The logical processors.
+     */
+    Processor processors[EOOS_GLOBAL_SYS_NUMBER_OF_PROCESSORS];
+
+    /**
+     * @brief Processors of the cores.
+     */
+    ::GROUP_AFFINITY cores[EOOS_GLOBAL_SYS_NUMBER_OF_PROCESSORS];
+
+    /**
+     * @brief Processors of the packages in their first groups.
+     */
+    ::GROUP_AFFINITY packages[EOOS_GLOBAL_SYS_NUMBER_OF_NODES];
+
+    /**
+     * @brief Processors of the NUMA nodes.
+     */
+    ::GROUP_AFFINITY nodes[EOOS_GLOBAL_SYS_NUMBER_OF_NODES];
+
+    /**
+     * @brief Numbers of the NUMA nodes.
+     */
+    int32_t nodeNumbers[EOOS_GLOBAL_SYS_NUMBER_OF_NODES];
+
+    /**
+     * @brief The caches.
+     */
+    Cache caches[EOOS_GLOBAL_SYS_NUMBER_OF_CACHES];
+};
+
+ProcessorTopology::Pool ProcessorTopology::pool_{};
+
+ProcessorTopology::ProcessorTopology() noexcept
+    : NonCopyable<NoAllocator>()
+    , Topology() {
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+bool_t ProcessorTopology::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+int32_t ProcessorTopology::getNumberOfProcessors() const noexcept
+{
+    return numberOfProcessors_;
+}
+
+int32_t ProcessorTopology::getNumberOfCores() const noexcept
+{
+    return numberOfCores_;
+}
+
+int32_t ProcessorTopology::getNumberOfPackages() const noexcept
+{
+    return numberOfPackages_;
+}
+
+int32_t ProcessorTopology::getNumberOfNodes() const noexcept
+{
+    return numberOfNodes_;
+}
+
+int32_t ProcessorTopology::getNumberOfCaches() const noexcept
+{
+    return numberOfCaches_;
+}
+
+bool_t ProcessorTopology::getProcessor(int32_t index, Processor& processor) const noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() && (index >= 0) && (index < numberOfProcessors_) )
+    {
+        processor = pool_.processors[index];
+        res = true;
+    }
+    return res;
+}
+
+bool_t ProcessorTopology::getCache(int32_t index, Cache& cache) const noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() && (index >= 0) && (index < numberOfCaches_) )
+    {
+        cache = pool_.caches[index];
+        res = true;
+    }
+    return res;
+}
+
+size_t ProcessorTopology::getCacheSize(int32_t level) const noexcept
+{
+    size_t size{ 0U };
+    for(int32_t i{0}; (i<numberOfCaches_) && (size == 0U); i++)
+    {
+        Cache const& cache{ pool_.caches[i] };
+        if( (cache.level == level) && ((cache.type == CACHE_DATA) || (cache.type == CACHE_UNIFIED)) )
+        {
+            size = cache.size;
+        }
+    }
+    return size;
+}
+
+bool_t ProcessorTopology::getCoreAffinity(int32_t core, uint16_t& group, uint64_t& mask) const noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() && (core >= 0) && (core < numberOfCores_) )
+    {
+        group = static_cast<uint16_t>(pool_.cores[core].Group);
+        mask = static_cast<uint64_t>(pool_.cores[core].Mask);
+        res = true;
+    }
+    return res;
+}
+
+bool_t ProcessorTopology::getPackageAffinity(int32_t package, uint16_t& group, uint64_t& mask) const noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() && (package >= 0) && (package < numberOfPackages_) )
+    {
+        group = static_cast<uint16_t>(pool_.packages[package].Group);
+        mask = static_cast<uint64_t>(pool_.packages[package].Mask);
+        res = true;
+    }
+    return res;
+}
+
+bool_t ProcessorTopology::getNodeAffinity(int32_t node, uint16_t& group, uint64_t& mask) const noexcept
+{
+    bool_t res{ false };
+    for(int32_t i{0}; (i<numberOfNodes_) && (!res); i++)
+    {
+        if(pool_.nodeNumbers[i] == node)
+        {
+            group = static_cast<uint16_t>(pool_.nodes[i].Group);
+            mask = static_cast<uint64_t>(pool_.nodes[i].Mask);
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t ProcessorTopology::construct() noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        // Query the size of the records, and then the records to a temporary buffer
+        ::DWORD length{ 0U };
+        static_cast<void>( ::GetLogicalProcessorInformationEx(RelationAll, NULL, &length) );
+        ::LPVOID const buffer{ (length == 0U) ? NULL : ::VirtualAlloc(NULL, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE) };
+        if(buffer != NULL)
+        {
+            ucell_t const* const records{ static_cast<ucell_t const*>(buffer) };
+            if( ::GetLogicalProcessorInformationEx(RelationAll, static_cast< ::PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX >(buffer), &length) != 0 )
+            {
+                ::DWORD offset{ 0U };
+                ::DWORD size{ 1U };
+                while( (offset < length) && (size != 0U) )
+                {
+                    ::SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const* const info{ reinterpret_cast< ::SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const* >(&records[offset]) }; ///< SCA AUTOSAR-C++14 Justified Rule A5-2-4
+                    add(*info);
+                    size = info->Size;
+                    offset += size;
+                }
+                // Packages and nodes are reported after cores, so link processors to them at last
+                for(int32_t i{0}; i<numberOfProcessors_; i++)
+                {
+                    Processor& processor{ pool_.processors[i] };
+                    processor.package = find(pool_.packages, numberOfPackages_, processor);
+                    int32_t const node{ find(pool_.nodes, numberOfNodes_, processor) };
+                    processor.node = (node < 0) ? -1 : pool_.nodeNumbers[node];
+                }
+                res = numberOfProcessors_ > 0;
+            }
+            static_cast<void>( ::VirtualFree(buffer, 0U, MEM_RELEASE) );
+        }
+    }
+    return res;
+}
+
+void ProcessorTopology::add(::SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX const& info) noexcept
+{
+    if(info.Relationship == RelationProcessorCore)
+    {
+        if(numberOfCores_ < EOOS_GLOBAL_SYS_NUMBER_OF_PROCESSORS)
+        {
+            ::GROUP_AFFINITY const& affinity{ info.Processor.GroupMask[0] };
+            int32_t const core{ numberOfCores_++ };
+            pool_.cores[core] = affinity;
+            uint32_t const bits{ static_cast<uint32_t>(sizeof(::KAFFINITY) * 8U) };
+            for(uint32_t bit{0U}; (bit < bits) && (numberOfProcessors_ < EOOS_GLOBAL_SYS_NUMBER_OF_PROCESSORS); bit++)
+            {
+                if( ((affinity.Mask >> bit) & 1U) != 0U )
+                {
+                    Processor& processor{ pool_.processors[numberOfProcessors_++] };
+                    processor.group = static_cast<uint16_t>(affinity.Group);
+                    processor.number = static_cast<uint8_t>(bit);
+                    processor.core = core;
+                    processor.package = -1;
+                    processor.node = -1;
+                }
+            }
+        }
+    }
+    else if(info.Relationship == RelationProcessorPackage)
+    {
+        if(numberOfPackages_ < EOOS_GLOBAL_SYS_NUMBER_OF_NODES)
+        {
+            pool_.packages[numberOfPackages_++] = info.Processor.GroupMask[0];
+        }
+    }
+    else if(info.Relationship == RelationNumaNode)
+    {
+        if(numberOfNodes_ < EOOS_GLOBAL_SYS_NUMBER_OF_NODES)
+        {
+            pool_.nodes[numberOfNodes_] = info.NumaNode.GroupMask;
+            pool_.nodeNumbers[numberOfNodes_] = static_cast<int32_t>(info.NumaNode.NodeNumber);
+            numberOfNodes_++;
+        }
+    }
+    else if(info.Relationship == RelationCache)
+    {
+        if(numberOfCaches_ < EOOS_GLOBAL_SYS_NUMBER_OF_CACHES)
+        {
+            Cache& cache{ pool_.caches[numberOfCaches_++] };
+            cache.level = static_cast<int32_t>(info.Cache.Level);
+            // The cache type constants have the values of the system ones
+            cache.type = static_cast<int32_t>(info.Cache.Type);
+            cache.size = static_cast<size_t>(info.Cache.CacheSize);
+            cache.lineSize = static_cast<size_t>(info.Cache.LineSize);
+            cache.group = static_cast<uint16_t>(info.Cache.GroupMask.Group);
+            cache.mask = static_cast<uint64_t>(info.Cache.GroupMask.Mask);
+        }
+    }
+    else
+    {
+        // Processor groups are not reported
+    }
+}
+
+int32_t ProcessorTopology::find(::GROUP_AFFINITY const* const sets, int32_t const number, Processor const& processor) noexcept
+{
+    int32_t index{ -1 };
+    for(int32_t i{0}; (i<number) && (index < 0); i++)
+    {
+        if( (sets[i].Group == processor.group) && (((sets[i].Mask >> processor.number) & 1U) != 0U) )
+        {
+            index = i;
+        }
+    }
+    return index;
+}
+
+} // namespace sys
+} // namespace eoos
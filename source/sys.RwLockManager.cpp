@@ -0,0 +1,84 @@
+/**
+ * @file      sys.RwLockManager.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.RwLockManager.hpp"
+#include "sys.RwLockSlim.hpp"
+#include "sys.ResourcePool.hpp"
+#include "lib.UniquePointer.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+struct RwLockManager::Pool
+{
+    /**
+     * @brief Memory of reader-writer locks.
+     */
+    ResourcePool<sizeof(RwLockSlim<RwLockManager>), EOOS_GLOBAL_SYS_NUMBER_OF_RWLOCKS> locks;
+};
+
+RwLockManager::Pool RwLockManager::pool_{};
+
+RwLockManager::RwLockManager() noexcept 
+    : NonCopyable<NoAllocator>()
+    , RwLockFactory() {
+    setConstructed( true );
+}
+
+bool_t RwLockManager::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}    
+
+RwLock* RwLockManager::create() noexcept
+{
+    return create(false);
+}
+
+RwLock* RwLockManager::create(bool_t isWriterPreferred) noexcept try
+{
+    lib::UniquePointer<RwLock> res;
+    if( isConstructed() )
+    {   
+        res.reset( new RwLockSlim<RwLockManager>(isWriterPreferred) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        if( !res.isNull() )
+        {
+            if( !res->isConstructed() )
+            {   ///< UT Justified Branch: HW dependency
+                res.reset();
+            }
+        }
+    }
+    return res.release();
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return NULLPTR;
+}
+
+void* RwLockManager::allocate(size_t size)
+{
+    void* addr{ pool_.locks.allocate(size) };
+    if(addr == NULLPTR)
+    {
+        addr = Allocator::allocate(size);
+    }
+    return addr;
+}
+
+void RwLockManager::free(void* ptr)
+{
+    if( pool_.locks.isOwned(ptr) )
+    {
+        pool_.locks.free(ptr);
+    }
+    else
+    {
+        Allocator::free(ptr);
+    }
+}
+
+} // namespace sys
+} // namespace eoos
@@ -5,31 +5,79 @@
  */
 #include "sys.Scheduler.hpp"
 #include "sys.Thread.hpp"
+#include "sys.ThreadCached.hpp"
+#include "sys.ResourcePool.hpp"
 #include "lib.UniquePointer.hpp"
 
 namespace eoos
 {
 namespace sys
 {
+
+struct Scheduler::Pool
+{
+    /**
+     * @brief Memory of threads.
+     */
+    ResourcePool<(sizeof(Thread<Scheduler>) > sizeof(ThreadCached<Scheduler>)) ? sizeof(Thread<Scheduler>) : sizeof(ThreadCached<Scheduler>), EOOS_GLOBAL_SYS_NUMBER_OF_THREADS> threads;
+};
+
+Scheduler::Pool Scheduler::pool_{};
+
+const ::DWORD Scheduler::PRIORITY_CLASSES[CLASS_REALTIME + 1]{
+    IDLE_PRIORITY_CLASS,
+    BELOW_NORMAL_PRIORITY_CLASS,
+    NORMAL_PRIORITY_CLASS,
+    ABOVE_NORMAL_PRIORITY_CLASS,
+    HIGH_PRIORITY_CLASS,
+    REALTIME_PRIORITY_CLASS
+};
     
 Scheduler::Scheduler() noexcept
     : NonCopyable<NoAllocator>()
-    , api::Scheduler() {
+    , api::Scheduler()
+    , ThreadFactory()
+    , ProcessPriority() {
     bool_t const isConstructed{ construct() };
     setConstructed( isConstructed );
 }
 
+Scheduler::~Scheduler() noexcept
+{
+    if( (processPriority_ != 0U) && (::GetPriorityClass(processHandle_) != processPriority_) )
+    {
+        static_cast<void>( ::SetPriorityClass(processHandle_, processPriority_) );
+    }
+}
+
 bool_t Scheduler::isConstructed() const noexcept
 {
     return Parent::isConstructed();
 }
 
-api::Thread* Scheduler::createThread(api::Task& task) noexcept try ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+AffineThread* Scheduler::createThread(api::Task& task) noexcept ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
 {
-    lib::UniquePointer<api::Thread> res;
+    return create(task);
+}
+
+AffineThread* Scheduler::create(api::Task& task) noexcept try ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+{
+    lib::UniquePointer<AffineThread> res;
     if( isConstructed() )
     {
-        res.reset( new Thread<Allocator>(task) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        ThreadCache::Carrier* const carrier{ task.isConstructed() ? cache_.acquire(task.getStackSize()) : NULLPTR };
+        if(carrier != NULLPTR)
+        {
+            res.reset( new ThreadCached<Scheduler>(task, *carrier) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+            if( res.isNull() )
+            {   ///< UT Justified Branch: HW dependency
+                carrier->release();
+            }
+        }
+        else
+        {
+            res.reset( new Thread<Scheduler>(task) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        }
         if( !res.isNull() )
         {
             if( !res->isConstructed() )
@@ -43,6 +91,33 @@ api::Thread* Scheduler::createThread(api::Task& task) noexcept try ///< SCA AUTO
     return NULLPTR;
 }
 
+AffineThread* Scheduler::create(api::Task& task, int32_t node) noexcept try ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+{
+    lib::UniquePointer<AffineThread> res;
+    if( isConstructed() )
+    {
+        if(node == AffineThread::NODE_ANY)
+        {
+            res.reset( create(task) );
+        }
+        else
+        {
+            // A new system thread is created, as a cached one has its stack where it has run
+            res.reset( new Thread<Scheduler>(task) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+            if( !res.isNull() )
+            {
+                if( !res->isConstructed() || !res->setNode(node) )
+                {
+                    res.reset();
+                }
+            }
+        }
+    }
+    return res.release();
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return NULLPTR;
+}
+
 bool_t Scheduler::sleep(int32_t ms) noexcept try
 {
     bool_t res{ false };
@@ -64,10 +139,69 @@ bool_t Scheduler::yield() noexcept try
     return false;
 }
 
+int32_t Scheduler::getPriorityClass() const noexcept
+{
+    int32_t res{ CLASS_WRONG };
+    if( isConstructed() )
+    {
+        ::DWORD const priorityClass{ ::GetPriorityClass(processHandle_) };
+        for(int32_t i{CLASS_IDLE}; (i<=CLASS_REALTIME) && (res == CLASS_WRONG); i++)
+        {
+            if(PRIORITY_CLASSES[i] == priorityClass)
+            {
+                res = i;
+            }
+        }
+    }
+    return res;
+}
+
+bool_t Scheduler::setPriorityClass(int32_t priorityClass) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() && (CLASS_IDLE <= priorityClass) && (priorityClass <= CLASS_REALTIME) )
+    {
+        res = ::SetPriorityClass(processHandle_, PRIORITY_CLASSES[priorityClass]) != 0;
+    }
+    return res;
+}
+
+Topology& Scheduler::getTopology() noexcept
+{
+    return topology_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
+}
+
+Executor& Scheduler::getExecutor() noexcept
+{
+    return executor_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
+}
+
+void* Scheduler::allocate(size_t size)
+{
+    void* addr{ pool_.threads.allocate(size) };
+    if(addr == NULLPTR)
+    {
+        addr = Allocator::allocate(size);
+    }
+    return addr;
+}
+
+void Scheduler::free(void* ptr)
+{
+    if( pool_.threads.isOwned(ptr) )
+    {
+        pool_.threads.free(ptr);
+    }
+    else
+    {
+        Allocator::free(ptr);
+    }
+}
+
 bool_t Scheduler::construct() noexcept try
 {
     bool_t res{ false };
-    if( isConstructed() )
+    if( isConstructed() && topology_.isConstructed() && executor_.isConstructed() && cache_.isConstructed() )
     {
         processHandle_ = ::GetCurrentProcess();
         if(processHandle_ != NULLPTR)
@@ -5,6 +5,8 @@
  */
 #include "sys.SemaphoreManager.hpp"
 #include "sys.Semaphore.hpp"
+#include "sys.SemaphoreLight.hpp"
+#include "sys.ResourcePool.hpp"
 #include "lib.UniquePointer.hpp"
 
 namespace eoos
@@ -12,6 +14,21 @@ namespace eoos
 namespace sys
 {
 
+struct SemaphoreManager::Pool
+{
+    /**
+     * @brief Memory of semaphores of the default type.
+     */
+    ResourcePool<sizeof(Semaphore<SemaphoreManager>), EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> semaphores;
+
+    /**
+     * @brief Memory of lightweight semaphores.
+     */
+    ResourcePool<sizeof(SemaphoreLight<SemaphoreManager>), EOOS_GLOBAL_SYS_NUMBER_OF_SEMAPHORES> lightSemaphores;
+};
+
+SemaphoreManager::Pool SemaphoreManager::pool_{};
+
 SemaphoreManager::SemaphoreManager() noexcept 
     : NonCopyable<NoAllocator>()
     , api::SemaphoreManager() {
@@ -23,12 +40,33 @@ bool_t SemaphoreManager::isConstructed() const noexcept
     return Parent::isConstructed();
 }    
 
-api::Semaphore* SemaphoreManager::create(int32_t permits) noexcept try
+CountingSemaphore* SemaphoreManager::create(int32_t permits) noexcept
 {
-    lib::UniquePointer<api::Semaphore> res;
+    return create(permits, Type::DEFAULT, 0U);
+}
+
+CountingSemaphore* SemaphoreManager::create(int32_t permits, Type type) noexcept
+{
+    return create(permits, type, 0U);
+}
+
+CountingSemaphore* SemaphoreManager::create(int32_t permits, Type type, uint32_t spinCount) noexcept try
+{
+    lib::UniquePointer<CountingSemaphore> res;
     if( isConstructed() )
     {
-        res.reset( new Semaphore<Allocator>(permits) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        if(type == Type::DEFAULT)
+        {
+            res.reset( new Semaphore<SemaphoreManager>(permits) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        }
+        else if(type == Type::LIGHT)
+        {
+            res.reset( new SemaphoreLight<SemaphoreManager>(permits, spinCount) ); ///< SCA AUTOSAR-C++14 Justified Rule A18-5-2
+        }
+        else
+        {
+            // The type is unknown
+        }
         if( !res.isNull() )
         {
             if( !res->isConstructed() )
@@ -42,5 +80,40 @@ api::Semaphore* SemaphoreManager::create(int32_t permits) noexcept try
     return NULLPTR;
 }
 
+void* SemaphoreManager::allocate(size_t size)
+{
+    // Lightweight semaphores are taken from their own pool to not waste bigger slots
+    void* addr{ NULLPTR };
+    if( size <= sizeof(SemaphoreLight<SemaphoreManager>) )
+    {
+        addr = pool_.lightSemaphores.allocate(size);
+    }
+    if(addr == NULLPTR)
+    {
+        addr = pool_.semaphores.allocate(size);
+    }
+    if(addr == NULLPTR)
+    {
+        addr = Allocator::allocate(size);
+    }
+    return addr;
+}
+
+void SemaphoreManager::free(void* ptr)
+{
+    if( pool_.lightSemaphores.isOwned(ptr) )
+    {
+        pool_.lightSemaphores.free(ptr);
+    }
+    else if( pool_.semaphores.isOwned(ptr) )
+    {
+        pool_.semaphores.free(ptr);
+    }
+    else
+    {
+        Allocator::free(ptr);
+    }
+}
+
 } // namespace sys
 } // namespace eoos
@@ -12,7 +12,7 @@ namespace eoos
 namespace sys
 {
         
-api::System* System::eoos_{ NULLPTR };
+System* System::eoos_{ NULLPTR };
 
 System::System() noexcept
     : NonCopyable<NoAllocator>()
@@ -31,37 +31,72 @@ bool_t System::isConstructed() const noexcept
     return Parent::isConstructed();
 }
 
-api::Heap& System::getHeap() noexcept
+Heap& System::getHeap() noexcept
 {
     return heap_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
 }
 
-api::Scheduler& System::getScheduler() noexcept
+Scheduler& System::getScheduler() noexcept
 {
     return scheduler_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
 }
 
-api::MutexManager& System::getMutexManager() noexcept
+MutexManager& System::getMutexManager() noexcept
 {
     return mutexManager_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
 }
 
-api::SemaphoreManager& System::getSemaphoreManager() noexcept
+RwLockManager& System::getRwLockManager() noexcept
+{
+    return rwLockManager_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
+}
+
+SemaphoreManager& System::getSemaphoreManager() noexcept
 {
     return semaphoreManager_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
 }
 
+ConditionManager& System::getConditionManager() noexcept
+{
+    return conditionManager_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
+}
+
+MultiWaiter& System::getMultiWaiter() noexcept
+{
+    return multiWaiter_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
+}
+
 api::StreamManager& System::getStreamManager() noexcept
 {
     return streamManager_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1    
 }
 
+HeapStatistics& System::getHeapStatistics() noexcept
+{
+    return heap_.getStatistics(); ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
+}
+
+HeapTrace& System::getHeapTrace() noexcept
+{
+    return heap_.getTrace(); ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
+}
+
+HeapBenchmark& System::getHeapBenchmark() noexcept
+{
+    return heapReplayer_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
+}
+
+LockStatistics& System::getLockStatistics() noexcept
+{
+    return lockProfiler_; ///< SCA AUTOSAR-C++14 Justified Rule A9-3-1
+}
+
 int32_t System::execute(int32_t argc, char_t* argv[]) const noexcept ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
 {
     return Program::start(argc, argv);
 }
 
-api::System& System::getSystem() noexcept
+System& System::getSystem() noexcept
 {
     if(eoos_ == NULLPTR)
     {   ///< UT Justified Branch: Startup dependency
@@ -76,9 +111,14 @@ bool_t System::construct() noexcept
     if( ( isConstructed() )
      && ( eoos_ == NULLPTR )
      && ( heap_.isConstructed() )
+     && ( heapReplayer_.isConstructed() )
+     && ( lockProfiler_.isConstructed() )
      && ( scheduler_.isConstructed() )
      && ( mutexManager_.isConstructed() )
+     && ( rwLockManager_.isConstructed() )
      && ( semaphoreManager_.isConstructed() )
+     && ( conditionManager_.isConstructed() )
+     && ( multiWaiter_.isConstructed() )
      && ( streamManager_.isConstructed() ) ) 
     {                
         eoos_ = this;
@@ -0,0 +1,122 @@
+/**
+ * @file      sys.ThreadAffinity.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ThreadAffinity.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+ThreadAffinity::ThreadAffinity() noexcept
+    : NonCopyable<NoAllocator>() {
+}
+
+bool_t ThreadAffinity::setAffinity(uint16_t group, uint64_t mask, ::HANDLE handle) noexcept
+{
+    bool_t res{ false };
+    ::KAFFINITY const affinity{ static_cast< ::KAFFINITY >(mask) };
+    // The mask shall fit the processors of a group of the system
+    if( (mask != 0U) && (static_cast<uint64_t>(affinity) == mask) )
+    {
+        ::GROUP_AFFINITY value{};
+        value.Mask = affinity;
+        value.Group = static_cast< ::WORD >(group);
+        if( setGroupAffinity(value, handle) )
+        {
+            affinity_ = value;
+            node_ = AffineThread::NODE_ANY;
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t ThreadAffinity::setIdealProcessor(uint32_t number, ::HANDLE handle) noexcept
+{
+    bool_t res{ false };
+    if(number < static_cast<uint32_t>(sizeof(::KAFFINITY) * 8U))
+    {
+        if( (handle == NULLPTR) || (::SetThreadIdealProcessor(handle, static_cast< ::DWORD >(number)) != static_cast< ::DWORD >(-1)) )
+        {
+            ideal_ = static_cast< ::DWORD >(number);
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool_t ThreadAffinity::setNode(int32_t node, ::HANDLE handle) noexcept
+{
+    bool_t res{ false };
+    if(node == AffineThread::NODE_ANY)
+    {
+        if( resetAffinity(handle) )
+        {
+            affinity_.Mask = 0U;
+            node_ = node;
+            res = true;
+        }
+    }
+    else
+    {
+        ::ULONG highest{ 0U };
+        ::GROUP_AFFINITY value{};
+        if( (node >= 0)
+         && (::GetNumaHighestNodeNumber(&highest) != 0)
+         && (static_cast< ::ULONG >(node) <= highest)
+         && (::GetNumaNodeProcessorMaskEx(static_cast< ::USHORT >(node), &value) != 0)
+         && (value.Mask != 0U)
+         && (setGroupAffinity(value, handle)) )
+        {
+            affinity_ = value;
+            node_ = node;
+            res = true;
+        }
+    }
+    return res;
+}
+
+int32_t ThreadAffinity::getNode() const noexcept
+{
+    return node_;
+}
+
+bool_t ThreadAffinity::apply(::HANDLE handle) const noexcept
+{
+    bool_t res{ false };
+    if(handle != NULLPTR)
+    {
+        res = (affinity_.Mask != 0U) ? setGroupAffinity(affinity_, handle) : resetAffinity(handle);
+        if( res && (ideal_ != IDEAL_ANY) )
+        {
+            res = ::SetThreadIdealProcessor(handle, ideal_) != static_cast< ::DWORD >(-1);
+        }
+    }
+    return res;
+}
+
+bool_t ThreadAffinity::setGroupAffinity(::GROUP_AFFINITY const& affinity, ::HANDLE handle) noexcept
+{
+    return (handle == NULLPTR) || (::SetThreadGroupAffinity(handle, &affinity, NULL) != 0);
+}
+
+bool_t ThreadAffinity::resetAffinity(::HANDLE handle) noexcept
+{
+    bool_t res{ handle == NULLPTR };
+    if(res == false)
+    {
+        ::DWORD_PTR processMask{ 0U };
+        ::DWORD_PTR systemMask{ 0U };
+        if( ::GetProcessAffinityMask(::GetCurrentProcess(), &processMask, &systemMask) != 0 )
+        {
+            res = ::SetThreadAffinityMask(handle, processMask) != 0U;
+        }
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
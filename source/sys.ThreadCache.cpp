@@ -0,0 +1,259 @@
+/**
+ * @file      sys.ThreadCache.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ThreadCache.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+struct ThreadCache::Pool
+{
+    /**
+     * @brief The carriers.
+     */
+    Carrier carriers[EOOS_GLOBAL_SYS_NUMBER_OF_CARRIERS];
+
+    /**
+     * @brief Lock of the carrier states.
+     */
+    ::SRWLOCK lock;
+
+    /**
+     * @brief Number of parked carriers.
+     */
+    int32_t numberOfIdle;
+
+    /**
+     * @brief The cache is stopped and carriers do not park.
+     */
+    bool_t isStopped;
+};
+
+ThreadCache::Pool ThreadCache::pool_{ {}, SRWLOCK_INIT, 0, false };
+
+ThreadCache::ThreadCache() noexcept
+    : NonCopyable<NoAllocator>() {
+}
+
+ThreadCache::~ThreadCache() noexcept
+{
+    ::AcquireSRWLockExclusive(&pool_.lock);
+    pool_.isStopped = true;
+    for(int32_t i{0}; i<EOOS_GLOBAL_SYS_NUMBER_OF_CARRIERS; i++)
+    {
+        Carrier& carrier{ pool_.carriers[i] };
+        if(carrier.state_ == Carrier::STATE_IDLE)
+        {
+            carrier.state_ = Carrier::STATE_DEAD;
+            carrier.task_ = NULLPTR;
+            static_cast<void>( ::SetEvent(carrier.start_) );
+            pool_.numberOfIdle--;
+        }
+    }
+    ::ReleaseSRWLockExclusive(&pool_.lock);
+    // Carriers running tasks are left, they exit when the tasks return
+    for(int32_t i{0}; i<EOOS_GLOBAL_SYS_NUMBER_OF_CARRIERS; i++)
+    {
+        Carrier& carrier{ pool_.carriers[i] };
+        if(carrier.state_ == Carrier::STATE_DEAD)
+        {
+            close(carrier);
+            carrier.state_ = Carrier::STATE_FREE;
+        }
+    }
+}
+
+bool_t ThreadCache::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+ThreadCache::Carrier* ThreadCache::acquire(size_t stackSize) noexcept try
+{
+    Carrier* res{ NULLPTR };
+    if( isConstructed() && (EOOS_GLOBAL_SYS_THREAD_CACHE_SIZE > 0) )
+    {
+        Carrier* free{ NULLPTR };
+        ::AcquireSRWLockExclusive(&pool_.lock);
+        for(int32_t i{0}; (i<EOOS_GLOBAL_SYS_NUMBER_OF_CARRIERS) && (res == NULLPTR) && (!pool_.isStopped); i++)
+        {
+            Carrier& carrier{ pool_.carriers[i] };
+            if( (carrier.state_ == Carrier::STATE_IDLE) && (carrier.stackSize_ == stackSize) )
+            {
+                pool_.numberOfIdle--;
+                res = &carrier;
+            }
+            else if( (free == NULLPTR) && ((carrier.state_ == Carrier::STATE_FREE) || (carrier.state_ == Carrier::STATE_DEAD)) )
+            {
+                free = &carrier;
+            }
+        }
+        if(res == NULLPTR)
+        {
+            res = free;
+        }
+        if(res != NULLPTR)
+        {
+            // Reserve the carrier, so a new one is created without the lock
+            res->state_ = Carrier::STATE_BUSY;
+            res->references_ = 1;
+        }
+        ::ReleaseSRWLockExclusive(&pool_.lock);
+        if( (res != NULLPTR) && (res == free) )
+        {
+            close(*res);
+            res->stackSize_ = stackSize;
+            res->start_ = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+            res->done_ = ::CreateEvent(NULL, TRUE, FALSE, NULL);
+            if( (res->start_ != NULLPTR) && (res->done_ != NULLPTR) )
+            {
+                res->handle_ = ::CreateThread(NULL, static_cast< ::SIZE_T >(stackSize), &run, res, 0U, NULL);
+            }
+            if(res->handle_ == NULLPTR)
+            {
+                close(*res);
+                ::AcquireSRWLockExclusive(&pool_.lock);
+                res->state_ = Carrier::STATE_FREE;
+                ::ReleaseSRWLockExclusive(&pool_.lock);
+                res = NULLPTR;
+            }
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return NULLPTR;
+}
+
+void ThreadCache::park(Carrier& carrier) noexcept
+{
+    ::AcquireSRWLockExclusive(&pool_.lock);
+    if( (!pool_.isStopped) && (pool_.numberOfIdle < EOOS_GLOBAL_SYS_THREAD_CACHE_SIZE) )
+    {
+        carrier.state_ = Carrier::STATE_IDLE;
+        pool_.numberOfIdle++;
+    }
+    else
+    {
+        carrier.state_ = Carrier::STATE_DEAD;
+        carrier.task_ = NULLPTR;
+        static_cast<void>( ::SetEvent(carrier.start_) );
+    }
+    ::ReleaseSRWLockExclusive(&pool_.lock);
+}
+
+void ThreadCache::close(Carrier& carrier) noexcept
+{
+    if(carrier.handle_ != NULLPTR)
+    {
+        static_cast<void>( ::WaitForSingleObject(carrier.handle_, INFINITE) );
+        static_cast<void>( ::CloseHandle(carrier.handle_) );
+        carrier.handle_ = NULLPTR;
+    }
+    if(carrier.start_ != NULLPTR)
+    {
+        static_cast<void>( ::CloseHandle(carrier.start_) );
+        carrier.start_ = NULLPTR;
+    }
+    if(carrier.done_ != NULLPTR)
+    {
+        static_cast<void>( ::CloseHandle(carrier.done_) );
+        carrier.done_ = NULLPTR;
+    }
+}
+
+::DWORD ThreadCache::run(::LPVOID argument) try ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+{
+    int32_t error{ -1 };
+    if(argument != NULLPTR)
+    {
+        Carrier* const carrier{ static_cast<Carrier*>(argument) }; ///< SCA AUTOSAR-C++14 Justified Rule M5-2-8
+        bool_t isRunning{ true };
+        while(isRunning)
+        {
+            ::DWORD const result{ ::WaitForSingleObject(carrier->start_, EOOS_GLOBAL_SYS_THREAD_CACHE_TIMEOUT) };
+            if(result == WAIT_OBJECT_0)
+            {
+                api::Task* const task{ carrier->task_ };
+                if(task != NULLPTR)
+                {
+                    try
+                    {
+                        task->start();
+                    }
+                    catch (...)
+                    {   ///< UT Justified Branch: OS dependency
+                        // The carrier survives an exception of a task
+                    }
+                    static_cast<void>( ::SetEvent(carrier->done_) );
+                    carrier->unreference();
+                }
+                else
+                {
+                    isRunning = false;
+                }
+            }
+            else
+            {
+                // Exit if the carrier has not been taken while it waited
+                ::AcquireSRWLockExclusive(&pool_.lock);
+                if(carrier->state_ == Carrier::STATE_IDLE)
+                {
+                    carrier->state_ = Carrier::STATE_DEAD;
+                    pool_.numberOfIdle--;
+                    isRunning = false;
+                }
+                ::ReleaseSRWLockExclusive(&pool_.lock);
+            }
+        }
+        error = 0;
+    }
+    return static_cast< ::DWORD >(error);
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return static_cast< ::DWORD >(-1);
+}
+
+ThreadCache::Carrier::Carrier() noexcept
+    : NonCopyable<NoAllocator>() {
+}
+
+bool_t ThreadCache::Carrier::execute(api::Task& task) noexcept
+{
+    static_cast<void>( ::InterlockedIncrement(&references_) );
+    task_ = &task;
+    bool_t const res{ (::ResetEvent(done_) != 0) && (::SetEvent(start_) != 0) };
+    if(res == false)
+    {   ///< UT Justified Branch: OS dependency
+        unreference();
+    }
+    return res;
+}
+
+void ThreadCache::Carrier::release() noexcept
+{
+    unreference();
+}
+
+::HANDLE ThreadCache::Carrier::getDoneEvent() const noexcept
+{
+    return done_;
+}
+
+::HANDLE ThreadCache::Carrier::getHandle() const noexcept
+{
+    return handle_;
+}
+
+void ThreadCache::Carrier::unreference() noexcept
+{
+    if( ::InterlockedDecrement(&references_) == 0 )
+    {
+        ThreadCache::park(*this);
+    }
+}
+
+} // namespace sys
+} // namespace eoos
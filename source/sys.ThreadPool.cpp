@@ -0,0 +1,540 @@
+/**
+ * @file      sys.ThreadPool.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ThreadPool.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+/**
+ * @brief Number of tasks of a queue.
+ */
+static const ::LONG64 QUEUE_SIZE{ EOOS_GLOBAL_SYS_EXECUTOR_QUEUE_SIZE };
+
+/**
+ * @brief Mask of a task index of a queue.
+ */
+static const ::LONG64 QUEUE_MASK{ QUEUE_SIZE - 1 };
+
+/**
+ * @class ThreadPool::Worker
+ * @brief Worker thread with its deque of tasks.
+ *
+ * The deque is the Chase-Lev deque of a fixed size. Only the worker thread pushes and pops
+ * tasks at the bottom, other threads steal tasks at the top, and the top index is only incremented
+ * by an interlocked compare exchange, which resolves a race for the last task.
+ */
+class ThreadPool::Worker : public NonCopyable<NoAllocator>
+{
+    using Parent = NonCopyable<NoAllocator>;
+
+public:
+
+    /**
+     * @brief Constructor.
+     */
+    Worker() noexcept
+        : NonCopyable<NoAllocator>() {
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~Worker() noexcept override
+    {
+        join();
+    }
+
+    /**
+     * @brief Starts the worker thread.
+     *
+     * @param pool  The pool of the worker.
+     * @param index Index of the worker.
+     * @return True if the thread has been started.
+     */
+    bool_t start(ThreadPool& pool, uint32_t index) noexcept
+    {
+        pool_ = &pool;
+        // Seed of the xorshift generator, which shall not be zero
+        seed_ = (index * 0x9E3779B9U) | 1U;
+        handle_ = ::CreateThread(NULL, 0U, &ThreadPool::run, this, 0U, NULL);
+        return handle_ != NULLPTR;
+    }
+
+    /**
+     * @brief Waits for the worker thread to exit.
+     */
+    void join() noexcept
+    {
+        if(handle_ != NULLPTR)
+        {
+            static_cast<void>( ::WaitForSingleObject(handle_, INFINITE) );
+            static_cast<void>( ::CloseHandle(handle_) );
+            handle_ = NULLPTR;
+        }
+    }
+
+    /**
+     * @brief Returns the pool of the worker.
+     *
+     * @return The pool, or NULLPTR if the worker has not been started.
+     */
+    ThreadPool* getPool() const noexcept
+    {
+        return pool_;
+    }
+
+    /**
+     * @brief Pushes a task to the bottom by the worker thread.
+     *
+     * @param task The task.
+     * @return True if the task has been pushed.
+     */
+    bool_t push(api::Task* const task) noexcept
+    {
+        bool_t res{ false };
+        ::LONG64 const bottom{ bottom_ };
+        if( (bottom - top_) < QUEUE_SIZE )
+        {
+            tasks_[bottom & QUEUE_MASK] = task;
+            // Publish the task before the bottom
+            static_cast<void>( ::InterlockedExchange64(&bottom_, bottom + 1) );
+            res = true;
+        }
+        return res;
+    }
+
+    /**
+     * @brief Pops a task from the bottom by the worker thread.
+     *
+     * @return The task, or NULLPTR if the deque is empty.
+     */
+    api::Task* pop() noexcept
+    {
+        api::Task* task{ NULLPTR };
+        ::LONG64 const bottom{ bottom_ - 1 };
+        // Reserve the bottom task before reading the top
+        static_cast<void>( ::InterlockedExchange64(&bottom_, bottom) );
+        ::LONG64 const top{ top_ };
+        if(top <= bottom)
+        {
+            task = tasks_[bottom & QUEUE_MASK];
+            if(top == bottom)
+            {
+                // The last task, race with the thieves for it
+                if( ::InterlockedCompareExchange64(&top_, top + 1, top) != top )
+                {
+                    task = NULLPTR;
+                }
+                static_cast<void>( ::InterlockedExchange64(&bottom_, bottom + 1) );
+            }
+        }
+        else
+        {
+            static_cast<void>( ::InterlockedExchange64(&bottom_, bottom + 1) );
+        }
+        return task;
+    }
+
+    /**
+     * @brief Steals a task from the top by another thread.
+     *
+     * @return The task, or NULLPTR if the deque is empty or another thread has taken the task.
+     */
+    api::Task* steal() noexcept
+    {
+        api::Task* task{ NULLPTR };
+        ::LONG64 const top{ top_ };
+        ::MemoryBarrier();
+        ::LONG64 const bottom{ bottom_ };
+        if(top < bottom)
+        {
+            task = tasks_[top & QUEUE_MASK];
+            if( ::InterlockedCompareExchange64(&top_, top + 1, top) != top )
+            {
+                task = NULLPTR;
+            }
+        }
+        return task;
+    }
+
+    /**
+     * @brief Tests if the deque is empty.
+     *
+     * @return True if the deque has no tasks.
+     */
+    bool_t isEmpty() const noexcept
+    {
+        return bottom_ <= top_;
+    }
+
+    /**
+     * @brief Returns a pseudo-random number for the worker thread.
+     *
+     * @return The number.
+     */
+    uint32_t random() noexcept
+    {
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 17;
+        seed_ ^= seed_ << 5;
+        return seed_;
+    }
+
+private:
+
+    /**
+     * @copydoc eoos::Object::Object(Object const&)
+     */
+    Worker(Worker const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object const&)
+     */
+    Worker& operator=(Worker const&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::Object(Object&&)
+     */
+    Worker(Worker&&) noexcept = delete;
+
+    /**
+     * @copydoc eoos::Object::operator=(Object&&)
+     */
+    Worker& operator=(Worker&&) & noexcept = delete;
+
+    /**
+     * @brief Index of the top task, which is changed by the thieves.
+     */
+    ::LONG64 volatile top_{ 0 };
+
+    /**
+     * @brief The tasks, which also separate the indexes in memory.
+     */
+    api::Task* volatile tasks_[EOOS_GLOBAL_SYS_EXECUTOR_QUEUE_SIZE];
+
+    /**
+     * @brief Index next to the bottom task, which is changed by the worker thread.
+     */
+    ::LONG64 volatile bottom_{ 0 };
+
+    /**
+     * @brief State of the pseudo-random generator.
+     */
+    uint32_t seed_{ 1U };
+
+    /**
+     * @brief The pool of the worker.
+     */
+    ThreadPool* pool_{ NULLPTR };
+
+    /**
+     * @brief The worker thread.
+     */
+    ::HANDLE handle_{ NULLPTR };
+
+};
+
+struct ThreadPool::Pool
+{
+    /**
+     * @brief The workers.
+     */
+    Worker workers[EOOS_GLOBAL_SYS_NUMBER_OF_WORKERS];
+
+    /**
+     * @brief Tasks of the shared queue.
+     */
+    api::Task* tasks[EOOS_GLOBAL_SYS_EXECUTOR_QUEUE_SIZE];
+
+    /**
+     * @brief Index of the first task of the shared queue.
+     */
+    ::LONG64 head;
+
+    /**
+     * @brief Number of tasks of the shared queue, which is read without the lock.
+     */
+    ::LONG64 volatile count;
+
+    /**
+     * @brief Lock of the shared queue.
+     */
+    ::SRWLOCK lock;
+};
+
+ThreadPool::Pool ThreadPool::pool_{ {}, {}, 0, 0, SRWLOCK_INIT };
+
+ThreadPool::ThreadPool(Topology& topology) noexcept
+    : NonCopyable<NoAllocator>()
+    , Executor()
+    , topology_( topology ) {
+    bool_t const isConstructed{ construct() };
+    setConstructed( isConstructed );
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+    ::LONG const number{ numberOfWorkers_ };
+    static_cast<void>( ::InterlockedExchange(&isStopped_, 1) );
+    if(number > 0)
+    {
+        static_cast<void>( ::ReleaseSemaphore(semaphore_, number, NULL) );
+        for(::LONG i{0}; i<number; i++)
+        {
+            pool_.workers[i].join();
+        }
+    }
+    if(semaphore_ != NULLPTR)
+    {
+        static_cast<void>( ::CloseHandle(semaphore_) );
+        semaphore_ = NULLPTR;
+    }
+    if(tlsIndex_ != TLS_OUT_OF_INDEXES)
+    {
+        static_cast<void>( ::TlsFree(tlsIndex_) );
+        tlsIndex_ = TLS_OUT_OF_INDEXES;
+    }
+}
+
+bool_t ThreadPool::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+bool_t ThreadPool::submit(api::Task& task) noexcept try ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+{
+    bool_t res{ false };
+    if( isConstructed() && task.isConstructed() && start() )
+    {
+        // A worker pushes tasks to its own deque
+        Worker* const worker{ static_cast<Worker*>( ::TlsGetValue(tlsIndex_) ) };
+        if( (worker != NULLPTR) && (worker->getPool() == this) )
+        {
+            res = worker->push(&task);
+        }
+        if(res == false)
+        {
+            res = put(&task);
+        }
+        if(res == true)
+        {
+            wakeUp();
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+int32_t ThreadPool::getNumberOfWorkers() const noexcept
+{
+    return static_cast<int32_t>(numberOfWorkers_);
+}
+
+bool_t ThreadPool::construct() noexcept try
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        tlsIndex_ = ::TlsAlloc();
+        if(tlsIndex_ != TLS_OUT_OF_INDEXES)
+        {
+            semaphore_ = ::CreateSemaphore(NULL, 0, MAXIMUM_COUNT, NULL);
+            res = semaphore_ != NULLPTR;
+        }
+    }
+    return res;
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return false;
+}
+
+bool_t ThreadPool::start() noexcept
+{
+    if( (numberOfWorkers_ == 0) && (isStopped_ == 0) )
+    {
+        ::AcquireSRWLockExclusive(&startLock_);
+        if(numberOfWorkers_ == 0)
+        {
+            ::LONG number{ static_cast< ::LONG >( topology_.getNumberOfProcessors() ) };
+            if(number > EOOS_GLOBAL_SYS_NUMBER_OF_WORKERS)
+            {
+                number = EOOS_GLOBAL_SYS_NUMBER_OF_WORKERS;
+            }
+            ::LONG started{ 0 };
+            while( (started < number) && pool_.workers[started].start(*this, static_cast<uint32_t>(started)) )
+            {
+                started++;
+            }
+            // The workers see the number only after all of them started, which they wait for to steal
+            static_cast<void>( ::InterlockedExchange(&numberOfWorkers_, started) );
+        }
+        ::ReleaseSRWLockExclusive(&startLock_);
+    }
+    return numberOfWorkers_ > 0;
+}
+
+void ThreadPool::execute(Worker& worker) noexcept
+{
+    bool_t isRunning{ true };
+    while(isRunning)
+    {
+        // Read the flag before taking, so the tasks submitted before the stopping are seen
+        bool_t const isStopped{ isStopped_ != 0 };
+        api::Task* const task{ take(worker) };
+        if(task != NULLPTR)
+        {
+            try
+            {
+                task->start();
+            }
+            catch (...)
+            {   ///< UT Justified Branch: OS dependency
+                // The worker survives an exception of a task
+            }
+        }
+        else if(isStopped)
+        {
+            // The tasks left are executed by the workers whose tasks have submitted them
+            isRunning = false;
+        }
+        else
+        {
+            park();
+        }
+    }
+}
+
+api::Task* ThreadPool::take(Worker& worker) noexcept
+{
+    api::Task* task{ worker.pop() };
+    if(task == NULLPTR)
+    {
+        task = get();
+    }
+    if(task == NULLPTR)
+    {
+        // Steal beginning with a random worker to spread the thieves
+        uint32_t const number{ static_cast<uint32_t>(numberOfWorkers_) };
+        if(number > 1U)
+        {
+            uint32_t const first{ worker.random() % number };
+            for(uint32_t i{0U}; (i<number) && (task == NULLPTR); i++)
+            {
+                Worker& victim{ pool_.workers[(first + i) % number] };
+                if(&victim != &worker)
+                {
+                    task = victim.steal();
+                }
+            }
+        }
+    }
+    return task;
+}
+
+void ThreadPool::park() noexcept
+{
+    static_cast<void>( ::InterlockedIncrement(&numberOfParked_) );
+    // Recheck the queues as a task may have been submitted before the worker was counted parked
+    bool_t isParked{ true };
+    if( hasTasks() || (isStopped_ != 0) )
+    {
+        ::LONG parked{ numberOfParked_ };
+        while( (parked > 0) && isParked )
+        {
+            ::LONG const value{ ::InterlockedCompareExchange(&numberOfParked_, parked - 1, parked) };
+            if(value == parked)
+            {
+                isParked = false;
+            }
+            parked = value;
+        }
+    }
+    if(isParked)
+    {
+        // A submitting thread uncounted this worker, or another worker took its place
+        static_cast<void>( ::WaitForSingleObject(semaphore_, INFINITE) );
+    }
+}
+
+void ThreadPool::wakeUp() noexcept
+{
+    ::LONG parked{ numberOfParked_ };
+    while(parked > 0)
+    {
+        ::LONG const value{ ::InterlockedCompareExchange(&numberOfParked_, parked - 1, parked) };
+        if(value == parked)
+        {
+            static_cast<void>( ::ReleaseSemaphore(semaphore_, 1, NULL) );
+            break;
+        }
+        parked = value;
+    }
+}
+
+bool_t ThreadPool::hasTasks() const noexcept
+{
+    bool_t res{ pool_.count > 0 };
+    ::LONG const number{ numberOfWorkers_ };
+    for(::LONG i{0}; (i<number) && (!res); i++)
+    {
+        res = !pool_.workers[i].isEmpty();
+    }
+    return res;
+}
+
+bool_t ThreadPool::put(api::Task* const task) noexcept
+{
+    bool_t res{ false };
+    ::AcquireSRWLockExclusive(&pool_.lock);
+    if(pool_.count < QUEUE_SIZE)
+    {
+        pool_.tasks[(pool_.head + pool_.count) & QUEUE_MASK] = task;
+        static_cast<void>( ::InterlockedIncrement64(&pool_.count) );
+        res = true;
+    }
+    ::ReleaseSRWLockExclusive(&pool_.lock);
+    return res;
+}
+
+api::Task* ThreadPool::get() noexcept
+{
+    api::Task* task{ NULLPTR };
+    if(pool_.count > 0)
+    {
+        ::AcquireSRWLockExclusive(&pool_.lock);
+        if(pool_.count > 0)
+        {
+            task = pool_.tasks[pool_.head & QUEUE_MASK];
+            pool_.head++;
+            static_cast<void>( ::InterlockedDecrement64(&pool_.count) );
+        }
+        ::ReleaseSRWLockExclusive(&pool_.lock);
+    }
+    return task;
+}
+
+::DWORD ThreadPool::run(::LPVOID argument) try ///< SCA AUTOSAR-C++14 Justified Rule A8-4-8
+{
+    int32_t error{ -1 };
+    if(argument != NULLPTR)
+    {
+        Worker* const worker{ static_cast<Worker*>(argument) }; ///< SCA AUTOSAR-C++14 Justified Rule M5-2-8
+        ThreadPool* const pool{ worker->getPool() };
+        if( (pool != NULLPTR) && (::TlsSetValue(pool->tlsIndex_, worker) != 0) )
+        {
+            pool->execute(*worker);
+            error = 0;
+        }
+    }
+    return static_cast< ::DWORD >(error);
+} catch (...) { ///< UT Justified Branch: OS dependency
+    return static_cast< ::DWORD >(-1);
+}
+
+} // namespace sys
+} // namespace eoos
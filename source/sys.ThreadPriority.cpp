@@ -0,0 +1,59 @@
+/**
+ * @file      sys.ThreadPriority.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.ThreadPriority.hpp"
+#include "api.Thread.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+bool_t ThreadPriority::isValid(int32_t priority) noexcept
+{
+    return ( (api::Thread::PRIORITY_MIN <= priority) && (priority <= api::Thread::PRIORITY_MAX) )
+        || ( priority == api::Thread::PRIORITY_IDLE );
+}
+
+int ThreadPriority::convert(int32_t priority) noexcept
+{
+    int res{ THREAD_PRIORITY_NORMAL };
+    if(priority == api::Thread::PRIORITY_IDLE)
+    {
+        res = THREAD_PRIORITY_IDLE;
+    }
+    else if(priority == api::Thread::PRIORITY_MAX)
+    {
+        res = THREAD_PRIORITY_TIME_CRITICAL;
+    }
+    else if(priority > api::Thread::PRIORITY_NORM)
+    {
+        int32_t const half{ (api::Thread::PRIORITY_MAX - api::Thread::PRIORITY_NORM) / 2 };
+        res = ( (priority - api::Thread::PRIORITY_NORM) <= half ) ? THREAD_PRIORITY_ABOVE_NORMAL : THREAD_PRIORITY_HIGHEST;
+    }
+    else if(priority < api::Thread::PRIORITY_NORM)
+    {
+        int32_t const half{ (api::Thread::PRIORITY_NORM - api::Thread::PRIORITY_MIN) / 2 };
+        res = ( (api::Thread::PRIORITY_NORM - priority) <= half ) ? THREAD_PRIORITY_BELOW_NORMAL : THREAD_PRIORITY_LOWEST;
+    }
+    else
+    {
+        res = THREAD_PRIORITY_NORMAL;
+    }
+    return res;
+}
+
+bool_t ThreadPriority::apply(::HANDLE handle, int32_t priority) noexcept
+{
+    bool_t res{ false };
+    if( (handle != NULLPTR) && isValid(priority) )
+    {
+        res = ::SetThreadPriority(handle, convert(priority)) != 0;
+    }
+    return res;
+}
+
+} // namespace sys
+} // namespace eoos
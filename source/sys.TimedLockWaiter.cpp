@@ -0,0 +1,27 @@
+/**
+ * @file      sys.TimedLockWaiter.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.TimedLockWaiter.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+TimedLockWaiter::TimedLockWaiter() noexcept
+    : NonCopyable<NoAllocator>() {
+}
+
+void TimedLockWaiter::notify() noexcept
+{
+    if(timedWaiters_ != 0)
+    {
+        static_cast<void>( ::InterlockedIncrement(&releases_) );
+        ::WakeByAddressAll( const_cast< ::LONG* >(&releases_) ); ///< SCA AUTOSAR-C++14 Justified Rule A5-2-3
+    }
+}
+
+} // namespace sys
+} // namespace eoos
@@ -0,0 +1,163 @@
+/**
+ * @file      sys.Timeout.cpp
+ * @author    Sergey Baigudin, sergey@baigudin.software
+ * @copyright 2023, Sergey Baigudin, Baigudin Software
+ */
+#include "sys.Timeout.hpp"
+
+namespace eoos
+{
+namespace sys
+{
+
+Timeout::Timeout(uint64_t us) noexcept
+    : NonCopyable<NoAllocator>() {
+    bool_t const isConstructed{ construct(us) };
+    setConstructed( isConstructed );
+}
+
+Timeout::~Timeout() noexcept
+{
+    if(timer_ != NULLPTR)
+    {
+        static_cast<void>( ::CloseHandle(timer_) );
+        timer_ = NULLPTR;
+    }
+}
+
+bool_t Timeout::isConstructed() const noexcept
+{
+    return Parent::isConstructed();
+}
+
+bool_t Timeout::isExpired() const noexcept
+{
+    return getRemaining() == 0;
+}
+
+::DWORD Timeout::wait(::HANDLE handle) noexcept
+{
+    return wait(&handle, 1U, false);
+}
+
+::DWORD Timeout::wait(::HANDLE const* const handles, ::DWORD const number, bool_t const isAll) noexcept
+{
+    // Take signaled objects without creating the timer
+    ::BOOL const bWaitAll{ isAll ? TRUE : FALSE };
+    ::DWORD res{ ::WaitForMultipleObjects(number, handles, bWaitAll, 0U) };
+    if( res == static_cast< ::DWORD >(WAIT_TIMEOUT) )
+    {
+        ::LONGLONG const remaining{ getRemaining() };
+        if(remaining > 0)
+        {
+            ::HANDLE const timer{ ( isAll || (number >= MAXIMUM_WAIT_OBJECTS) ) ? NULLPTR : setTimer(remaining) };
+            if(timer != NULLPTR)
+            {
+                ::HANDLE objects[MAXIMUM_WAIT_OBJECTS];
+                for(::DWORD i{0U}; i<number; i++)
+                {
+                    objects[i] = handles[i];
+                }
+                objects[number] = timer;
+                ::DWORD const error{ ::WaitForMultipleObjects(number + 1U, objects, FALSE, INFINITE) };
+                res = ( error == static_cast< ::DWORD >(WAIT_OBJECT_0 + number) ) ? static_cast< ::DWORD >(WAIT_TIMEOUT) : error;
+            }
+            else
+            {
+                res = ::WaitForMultipleObjects(number, handles, bWaitAll, getMilliseconds());
+            }
+        }
+    }
+    return res;
+}
+
+::DWORD Timeout::getMilliseconds() const noexcept
+{
+    ::LONGLONG ms{ 0 };
+    ::LONGLONG const remaining{ getRemaining() };
+    if(remaining > 0)
+    {
+        // Round the timeout up to not return before the deadline
+        ms = convert(remaining, 1000);
+        if( ms >= static_cast< ::LONGLONG >(INFINITE) )
+        {
+            ms = static_cast< ::LONGLONG >(INFINITE) - 1;
+        }
+    }
+    return static_cast< ::DWORD >(ms);
+}
+
+bool_t Timeout::construct(uint64_t us) noexcept
+{
+    bool_t res{ false };
+    if( isConstructed() )
+    {
+        ::LARGE_INTEGER frequency;
+        ::LARGE_INTEGER now;
+        if( (::QueryPerformanceFrequency(&frequency) != 0) && (frequency.QuadPart > 0) && (::QueryPerformanceCounter(&now) != 0) )
+        {
+            frequency_ = frequency.QuadPart;
+            // Split the conversion to avoid an overflow of the product, and saturate the deadline
+            uint64_t const max{ static_cast<uint64_t>(0x7FFFFFFFFFFFFFFF - now.QuadPart) };
+            uint64_t const freq{ static_cast<uint64_t>(frequency_) };
+            uint64_t const seconds{ us / 1000000U };
+            uint64_t ticks{ max };
+            if( seconds <= (max / freq) )
+            {
+                ticks = (seconds * freq) + ((((us % 1000000U) * freq) + 999999U) / 1000000U);
+                if(ticks > max)
+                {
+                    ticks = max;
+                }
+            }
+            deadline_ = now.QuadPart + static_cast< ::LONGLONG >(ticks);
+            res = true;
+        }
+    }
+    return res;
+}
+
+::LONGLONG Timeout::getRemaining() const noexcept
+{
+    ::LONGLONG remaining{ 0 };
+    ::LARGE_INTEGER now;
+    if( isConstructed() && (::QueryPerformanceCounter(&now) != 0) && (deadline_ > now.QuadPart) )
+    {
+        remaining = deadline_ - now.QuadPart;
+    }
+    return remaining;
+}
+
+::HANDLE Timeout::setTimer(::LONGLONG ticks) noexcept
+{
+    if(timer_ == NULLPTR)
+    {
+        timer_ = ::CreateWaitableTimerExW(NULL, NULL, WIN32_CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, WIN32_TIMER_ALL_ACCESS);
+        if(timer_ == NULLPTR)
+        {   ///< UT Justified Branch: OS dependency
+            timer_ = ::CreateWaitableTimerExW(NULL, NULL, 0U, WIN32_TIMER_ALL_ACCESS);
+        }
+    }
+    ::HANDLE res{ NULLPTR };
+    if(timer_ != NULLPTR)
+    {
+        // A negative due time is relative in 100 nanosecond intervals
+        ::LARGE_INTEGER dueTime;
+        dueTime.QuadPart = -convert(ticks, 10000000);
+        if( ::SetWaitableTimer(timer_, &dueTime, 0, NULL, NULL, FALSE) != 0 )
+        {
+            res = timer_;
+        }
+    }
+    return res;
+}
+
+::LONGLONG Timeout::convert(::LONGLONG ticks, ::LONGLONG units) const noexcept
+{
+    ::LONGLONG const seconds{ ticks / frequency_ };
+    ::LONGLONG const rest{ ticks % frequency_ };
+    return (seconds * units) + (((rest * units) + frequency_ - 1) / frequency_);
+}
+
+} // namespace sys
+} // namespace eoos